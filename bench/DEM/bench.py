@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+# run the LIGGGHTS DEM benchmarks and report steps/s and timing breakdown
+#
+# Syntax: bench.py [options] [benchmark ...]
+#   -e exe      LIGGGHTS executable (default: lmp_auto)
+#   -n P        # of MPI processes (default: 1)
+#   -m cmd      MPI launcher (default: "mpirun -np")
+#   -s S        length scale factor for a scaled-size run
+#               (default: 1 = fixed-size run), see README
+#   -l log ...  do not run, only report the given log files
+#   -r          compare with the reference logs in this directory
+#   benchmark   hopper, drum, packing, agglomerates, superquadric
+#               (default: all but superquadric)
+
+from __future__ import print_function
+import sys, os, re, glob, subprocess
+
+benchmarks = ["hopper","drum","packing","agglomerates","superquadric"]
+default_benchmarks = benchmarks[:-1]
+
+loop_pattern = re.compile(r"^Loop time of (\S+) on (\d+) procs.* for (\d+) steps with (\d+) atoms")
+time_pattern = re.compile(r"^(\w+)\s+time \(%\) = (\S+) \((\S+)\)")
+
+def error(msg):
+  print("ERROR:",msg)
+  sys.exit(1)
+
+# parse the timing of the last run in a log file
+# return dict with loop time, procs, steps, atoms and category percentages
+
+def parse_log(logfile):
+  result = None
+  for line in open(logfile):
+    m = loop_pattern.match(line)
+    if m:
+      result = {"time": float(m.group(1)), "procs": int(m.group(2)),
+                "steps": int(m.group(3)), "atoms": int(m.group(4)),
+                "categories": []}
+      continue
+    m = time_pattern.match(line)
+    if m and result is not None:
+      result["categories"].append((m.group(1),float(m.group(3))))
+  return result
+
+def report(name,result,ref=None):
+  if result is None:
+    print("%-28s no timing found" % name)
+    return
+  rate = result["steps"]/result["time"] if result["time"] > 0.0 else 0.0
+  line = "%-28s %6d procs %9d atoms %10.2f steps/s %12.4g atom-steps/s" % \
+    (name,result["procs"],result["atoms"],rate,rate*result["atoms"])
+  if ref:
+    refrate = ref["steps"]/ref["time"] if ref["time"] > 0.0 else 0.0
+    if refrate > 0.0: line += "  %5.2fx ref" % (rate/refrate)
+  print(line)
+  print("  " + "  ".join(["%s %.1f%%" % c for c in result["categories"]]))
+
+def find_ref(name,kind,procs):
+  refs = sorted(glob.glob("log.*.%s.%s.*.%d" % (name,kind,procs)))
+  if not refs: return None
+  return parse_log(refs[-1])
+
+# parse command line
+
+exe = "lmp_auto"
+nprocs = 1
+mpirun = "mpirun -np"
+scale = "1"
+logs = []
+compare = False
+names = []
+
+args = sys.argv[1:]
+while args:
+  arg = args.pop(0)
+  if arg in ("-e","-n","-m","-s"):
+    if not args: error("missing value for %s" % arg)
+    value = args.pop(0)
+    if arg == "-e": exe = value
+    elif arg == "-n": nprocs = int(value)
+    elif arg == "-m": mpirun = value
+    elif arg == "-s": scale = value
+  elif arg == "-l":
+    while args and not args[0].startswith("-"): logs.append(args.pop(0))
+  elif arg == "-r": compare = True
+  elif arg in benchmarks: names.append(arg)
+  else: error("unknown argument %s" % arg)
+
+os.chdir(os.path.dirname(os.path.abspath(__file__)))
+
+if logs:
+  for logfile in logs: report(logfile,parse_log(logfile))
+  sys.exit(0)
+
+if not names: names = default_benchmarks
+kind = "fixed" if float(scale) == 1.0 else "scaled"
+
+for name in names:
+  logfile = "log.%s.%s.%d" % (name,kind,nprocs)
+  cmd = "%s -in in.%s -var s %s -log %s -screen none" % (exe,name,scale,logfile)
+  if nprocs > 1: cmd = "%s %d %s" % (mpirun,nprocs,cmd)
+  if subprocess.call(cmd,shell=True) != 0:
+    print("%-28s failed, see %s" % (name,logfile))
+    continue
+  ref = find_ref(name,kind,nprocs) if compare else None
+  report("%s.%s" % (name,kind),parse_log(logfile),ref)
@@ -142,6 +142,62 @@ class lammps:
       return result
     return None
 
+  # NumPy views of internal per-atom and mesh data, no data is copied
+  # only atoms and mesh elements stored on this proc are included,
+  #   so no communication is done
+  # a view becomes invalid when LAMMPS re-allocates or re-orders the data,
+  #   e.g. when atoms migrate or are sorted during a run,
+  #   so extract the view again after each run command
+
+  def extract_atom_numpy(self,name):
+    datatype = self.lib.lammps_extract_atom_datatype(self.lmp,name)
+    count = self.lib.lammps_extract_atom_size(self.lmp,name)
+    if datatype < 0 or count < 1: return None
+    nlocal = self.extract_global("nlocal",0)
+    ctype = (c_int,c_double,c_int64)[datatype]
+    self.lib.lammps_extract_atom.restype = c_void_p
+    ptr = self.lib.lammps_extract_atom(self.lmp,name)
+    return self._numpy_view(ptr,ctype,nlocal,count)
+
+  def extract_fix_property_atom_numpy(self,name):
+    count = c_int()
+    self.lib.lammps_extract_fix_property_atom.restype = c_void_p
+    ptr = self.lib.lammps_extract_fix_property_atom(self.lmp,name,byref(count))
+    if not ptr: return None
+    nlocal = self.extract_global("nlocal",0)
+    return self._numpy_view(ptr,c_double,nlocal,count.value)
+
+  # node coords of owned mesh elements as array of shape (nelements,3,3)
+  # with ghost=True, ghost elements are appended
+  
+  def extract_mesh_nodes_numpy(self,id,ghost=False):
+    nlocal = c_int()
+    nghost = c_int()
+    nnodes = c_int()
+    self.lib.lammps_extract_mesh_nodes.restype = c_void_p
+    ptr = self.lib.lammps_extract_mesh_nodes(self.lmp,id,byref(nlocal),
+                                             byref(nghost),byref(nnodes))
+    if not ptr: return None
+    n = nlocal.value
+    if ghost: n += nghost.value
+    import numpy
+    if n == 0: return numpy.zeros((0,nnodes.value,3))
+    # pointer to first element's node pointers, then to first coord
+    plane = cast(ptr,POINTER(POINTER(POINTER(c_double))))[0]
+    return numpy.ctypeslib.as_array(plane[0],shape=(n,nnodes.value,3))
+
+  # ptr = pointer to vector, or to array of row pointers if count > 1
+  # rows of LAMMPS arrays are contiguous in memory
+
+  def _numpy_view(self,ptr,ctype,nlocal,count):
+    import numpy
+    if count == 1: shape = (nlocal,)
+    else: shape = (nlocal,count)
+    if not ptr or nlocal == 0: return numpy.zeros(shape,dtype=ctype)
+    if count == 1: data = cast(ptr,POINTER(ctype))
+    else: data = cast(ptr,POINTER(POINTER(ctype)))[0]
+    return numpy.ctypeslib.as_array(data,shape=shape)
+
   # return total number of atoms in system
   
   def get_natoms(self):
@@ -292,6 +292,18 @@ int MPI_Allreduce(void *sendbuf, void *recvbuf, int count,
 
 /* ---------------------------------------------------------------------- */
 
+/* copy values from data1 to data2, request completes immediately */
+
+int MPI_Iallreduce(void *sendbuf, void *recvbuf, int count,
+                   MPI_Datatype datatype, MPI_Op op, MPI_Comm comm,
+                   MPI_Request *request)
+{
+  *request = 0;
+  return MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
+}
+
+/* ---------------------------------------------------------------------- */
+
 /* copy values from data1 to data2 */
 
 int MPI_Reduce(void *sendbuf, void *recvbuf, int count,
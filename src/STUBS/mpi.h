@@ -117,6 +117,9 @@ int MPI_Bcast(void *buf, int count, MPI_Datatype datatype,
               int root, MPI_Comm comm);
 int MPI_Allreduce(void *sendbuf, void *recvbuf, int count,
                   MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
+int MPI_Iallreduce(void *sendbuf, void *recvbuf, int count,
+                   MPI_Datatype datatype, MPI_Op op, MPI_Comm comm,
+                   MPI_Request *request);
 int MPI_Reduce(void *sendbuf, void *recvbuf, int count,
                    MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm);
 int MPI_Scan(void *sendbuf, void *recvbuf, int count,
@@ -2484,45 +2484,64 @@ void FixLbFluid::parametercalc_part(int xstart, int xend, int ystart, int yend,
 //==========================================================================
 void FixLbFluid::update_periodic(int xstart, int xend, int ystart, int yend, int zstart, int zend)
 {
-  int i,j,k,m;
-  int imod,jmod,kmod,imodm,jmodm,kmodm;
-
-  for(i=xstart; i<xend; i++)
-    for(j=ystart; j<yend; j++)
-      for(k=zstart; k<zend; k++){
-	
-	if(typeLB==1){
-	  for(m=0; m<numvel; m++){
-	    imod = i-e[m][0];
-	    jmod = j-e[m][1];
-	    kmod = k-e[m][2];
+  // memory->create() stores the 4d arrays contiguously, so the site
+  // i-e[m] is at a constant offset from site i for each velocity m
+  // index the flat arrays with these offsets instead of dereferencing
+  // 3 row pointers per velocity, and stream and collide each site in
+  // a single pass over its velocities
+
+  const int sx = subNby*subNbz*numvel;
+  const int sy = subNbz*numvel;
+  int offset[19];
+  for(int m=0; m<numvel; m++)
+    offset[m] = e[m][0]*sx + e[m][1]*sy + e[m][2]*numvel;
+
+  const double *f0 = &f_lb[0][0][0][0];
+  const double *feq0 = &feq[0][0][0][0];
+  double *fnew0 = &fnew[0][0][0][0];
 
-	    fnew[i][j][k][m] = f_lb[imod][jmod][kmod][m] + (feq[imod][jmod][kmod][m]-f_lb[imod][jmod][kmod][m])/tau;
-	  }	    
-	}else if(typeLB==2){
-	  for(m=0; m<numvel; m++){
-	    imod = i-e[m][0];
-	    jmod = j-e[m][1];
-	    kmod = k-e[m][2];
-	    
-	    fnew[i][j][k][m] = feq[imod][jmod][kmod][m] + (f_lb[imod][jmod][kmod][m] - feq[imod][jmod][kmod][m])*expminusdtovertau;
+  if(typeLB==1){
+#if defined(_OPENMP)
+    #pragma omp parallel for default(shared)
+#endif
+    for(int i=xstart; i<xend; i++)
+      for(int j=ystart; j<yend; j++)
+	for(int k=zstart; k<zend; k++){
+	  const int n = i*sx + j*sy + k*numvel;
+	  double *fn = &fnew0[n];
+	  for(int m=0; m<numvel; m++){
+	    const int nm = n - offset[m] + m;
+	    fn[m] = f0[nm] + (feq0[nm]-f0[nm])/tau;
 	  }
-	  
-	  fnew[i][j][k][0]+=Dcoeff*(feq[i][j][k][0]-feqold[i][j][k][0]);
-	  for(m=1; m<numvel; m++){
-	    imod = i-e[m][0];
-	    jmod = j-e[m][1];
-	    kmod = k-e[m][2];
-	    imodm = i+e[m][0];
-	    jmodm = j+e[m][1];
-	    kmodm = k+e[m][2];
-	    
-	     fnew[i][j][k][m] += Dcoeff*(feq[i][j][k][m] - feqold[imod][jmod][kmod][m]) + (0.5-Dcoeff*(tau+0.5))*
-	       (feqn[imodm][jmodm][kmodm][m] - feqoldn[i][j][k][m] - feqn[i][j][k][m] + feqoldn[imod][jmod][kmod][m]);
-
+	}
+  }else if(typeLB==2){
+    const double *feqold0 = &feqold[0][0][0][0];
+    const double *feqn0 = &feqn[0][0][0][0];
+    const double *feqoldn0 = &feqoldn[0][0][0][0];
+    const double coeff = 0.5-Dcoeff*(tau+0.5);
+
+#if defined(_OPENMP)
+    #pragma omp parallel for default(shared)
+#endif
+    for(int i=xstart; i<xend; i++)
+      for(int j=ystart; j<yend; j++)
+	for(int k=zstart; k<zend; k++){
+	  const int n = i*sx + j*sy + k*numvel;
+	  double *fn = &fnew0[n];
+
+	  fn[0] = feq0[n] + (f0[n] - feq0[n])*expminusdtovertau;
+	  fn[0] += Dcoeff*(feq0[n]-feqold0[n]);
+
+	  for(int m=1; m<numvel; m++){
+	    const int nm = n - offset[m] + m;
+	    const int np = n + offset[m] + m;
+	    double fm = feq0[nm] + (f0[nm] - feq0[nm])*expminusdtovertau;
+	    fm += Dcoeff*(feq0[n+m] - feqold0[nm]) + coeff*
+	      (feqn0[np] - feqoldn0[n+m] - feqn0[n+m] + feqoldn0[nm]);
+	    fn[m] = fm;
 	  }
-	}		   
-      }  
+	}
+  }
 }
 
 //==========================================================================
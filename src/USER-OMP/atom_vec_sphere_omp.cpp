@@ -136,6 +136,27 @@ int AtomVecSphereOMP::unpack_exchange(double *buf)
   return m;
 }
 
+/* ---------------------------------------------------------------------- */
+
+int AtomVecSphereOMP::pack_exchange_bulk(int n, int *list, double *buf,
+                                         int &m, int mmax)
+{
+  int k = AtomVecSphere::pack_exchange_bulk(n, list, buf, m, mmax);
+  if (k) atom->dirty = true;
+  return k;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void AtomVecSphereOMP::unpack_exchange_bulk(int n, int *offset, double *buf)
+{
+  int nlocal = atom->nlocal;
+  AtomVecSphere::unpack_exchange_bulk(n, offset, buf);
+  for (int i = nlocal; i < atom->nlocal; i++)
+    thread[i] = -1; // don't know where these should go yet
+  if (n) atom->dirty = true;
+}
+
 /* ----------------------------------------------------------------------
    unpack data for one atom from restart file including extra quantities
 ------------------------------------------------------------------------- */
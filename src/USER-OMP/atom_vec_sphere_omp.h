@@ -52,6 +52,8 @@ public:
   void copy(int, int, int);
   int pack_exchange(int, double *);
   int unpack_exchange(double *);
+  int pack_exchange_bulk(int, int *, double *, int &, int);
+  void unpack_exchange_bulk(int, int *, double *);
   int unpack_restart(double *);
   void create_atom(int, double *);
   void data_atom(double *, tagint, char **);
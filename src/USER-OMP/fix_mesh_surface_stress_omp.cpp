@@ -38,19 +38,32 @@
 #include "modify.h"
 #include "comm.h"
 #include "math_extra.h"
+#include "memory.h"
+
+#include <omp.h>
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
 
 FixMeshSurfaceStressOMP::FixMeshSurfaceStressOMP(LAMMPS *lmp, int narg, char **arg)
-: FixMeshSurfaceStress(lmp, narg, arg)
+: FixMeshSurfaceStress(lmp, narg, arg),
+  nthreads_(comm->nthreads),
+  nbuffer_(0),
+  f_thr_(0),
+  wear_thr_(0),
+  total_thr_(0)
 {
+  memory->create(total_thr_,nthreads_,6,"mesh/surface/stress/omp:total_thr");
+  memset(&total_thr_[0][0],0,nthreads_*6*sizeof(double));
 }
 
 /* ---------------------------------------------------------------------- */
 
 FixMeshSurfaceStressOMP::~FixMeshSurfaceStressOMP()
 {
+  memory->destroy(f_thr_);
+  memory->destroy(wear_thr_);
+  memory->destroy(total_thr_);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -113,3 +126,118 @@ class FixNeighlistMesh* FixMeshSurfaceStressOMP::createOtherNeighList(int igrp,c
 
   return neighlist;
 }
+
+/* ----------------------------------------------------------------------
+   make sure thread buffers cover all owned and ghost triangles
+   buffers are all zero outside of a force computation, so
+   re-allocating them does not lose any data
+------------------------------------------------------------------------- */
+
+void FixMeshSurfaceStressOMP::grow_thread_buffers()
+{
+  // # of threads may have been changed by package omp
+
+  if(comm->nthreads != nthreads_) {
+    memory->destroy(f_thr_);
+    memory->destroy(wear_thr_);
+    memory->destroy(total_thr_);
+    nthreads_ = comm->nthreads;
+    nbuffer_ = 0;
+    memory->create(total_thr_,nthreads_,6,"mesh/surface/stress/omp:total_thr");
+    memset(&total_thr_[0][0],0,nthreads_*6*sizeof(double));
+  }
+
+  const int nTri = mesh()->size();
+  if(nthreads_ == 1 || nTri <= nbuffer_) return;
+
+  nbuffer_ = nTri;
+  memory->destroy(f_thr_);
+  memory->destroy(wear_thr_);
+  memory->create(f_thr_,nthreads_,3*nbuffer_,"mesh/surface/stress/omp:f_thr");
+  memory->create(wear_thr_,nthreads_,nbuffer_,"mesh/surface/stress/omp:wear_thr");
+  memset(&f_thr_[0][0],0,nthreads_*3*nbuffer_*sizeof(double));
+  memset(&wear_thr_[0][0],0,nthreads_*nbuffer_*sizeof(double));
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixMeshSurfaceStressOMP::pre_force(int vflag)
+{
+  FixMeshSurfaceStress::pre_force(vflag);
+
+  if(trackStress() || trackWear())
+    grow_thread_buffers();
+}
+
+/* ----------------------------------------------------------------------
+   called during wall force calc, possibly from several threads
+   each thread accumulates into its own buffers, no synchronization needed
+------------------------------------------------------------------------- */
+
+void FixMeshSurfaceStressOMP::add_particle_contribution(int ip,double *frc,
+                                double *delta,int iTri,double *v_wall)
+{
+  const int tid = omp_get_thread_num();
+
+  if(tid == 0 || nthreads_ == 1) {
+    FixMeshSurfaceStress::add_particle_contribution(ip,frc,delta,iTri,v_wall);
+    return;
+  }
+
+  add_contribution(ip,frc,delta,iTri,v_wall,
+                   trackStress() ? &f_thr_[tid][3*iTri] : 0,
+                   &total_thr_[tid][0],&total_thr_[tid][3],
+                   trackWear() ? &wear_thr_[tid][iTri] : 0);
+}
+
+/* ----------------------------------------------------------------------
+   add thread buffers to mesh properties in order of thread id,
+   so the result does not depend on thread scheduling, and zero them
+   has to be done before the reverse comm of the mesh properties
+------------------------------------------------------------------------- */
+
+void FixMeshSurfaceStressOMP::merge_thread_buffers()
+{
+  if(nthreads_ == 1) return;
+
+  const bool stress = trackStress();
+  const bool wear = trackWear();
+  const int nTri = nbuffer_ < mesh()->size() ? nbuffer_ : mesh()->size();
+
+  if(stress || wear)
+  {
+    #pragma omp parallel for
+    for(int i = 0; i < nTri; i++)
+    {
+      for(int tid = 1; tid < nthreads_; tid++)
+      {
+        if(stress)
+        {
+          double *f_tri = &f_thr_[tid][3*i];
+          vectorAdd3D(f(i),f_tri,f(i));
+          vectorZeroize3D(f_tri);
+        }
+        if(wear)
+        {
+          wear_step(i) += wear_thr_[tid][i];
+          wear_thr_[tid][i] = 0.;
+        }
+      }
+    }
+  }
+
+  for(int tid = 1; tid < nthreads_; tid++)
+  {
+    vectorAdd3D(f_total_,&total_thr_[tid][0],f_total_);
+    vectorAdd3D(torque_total_,&total_thr_[tid][3],torque_total_);
+    memset(&total_thr_[tid][0],0,6*sizeof(double));
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixMeshSurfaceStressOMP::final_integrate()
+{
+  merge_thread_buffers();
+  FixMeshSurfaceStress::final_integrate();
+}
@@ -46,6 +46,28 @@ namespace LAMMPS_NS
 
         virtual void createWallNeighList(int igrp);
         virtual class FixNeighlistMesh* createOtherNeighList(int igrp,const char *nId);
+
+        virtual void pre_force(int vflag);
+        virtual void final_integrate();
+
+        virtual void add_particle_contribution(int ip, double *frc,
+                            double *delta, int iTri, double *v_wall);
+
+        virtual bool threadsafeContribution()
+        { return true; }
+
+      private:
+
+        void grow_thread_buffers();
+        void merge_thread_buffers();
+
+        // per-thread accumulation buffers of threads 1..nthreads-1
+        // thread 0 adds to the mesh properties directly
+        int nthreads_;
+        int nbuffer_;           // # of triangles buffers are allocated for
+        double **f_thr_;        // triangle force, 3 per triangle
+        double **wear_thr_;     // triangle wear of this step
+        double **total_thr_;    // total force and torque, 6 values
   };
 
 } /* namespace LAMMPS_NS */
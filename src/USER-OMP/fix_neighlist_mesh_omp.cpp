@@ -172,6 +172,11 @@ void FixNeighlistMeshOMP::pre_force(int vflag)
       generate_bin_list(nall);
     }
 
+    // update bins of triangles of moving mesh that moved too far
+    if(changingMesh && !changingDomain) {
+      update_moving_bins(nall);
+    }
+
   const bool use_parallel = nall > static_cast<size_t>(nthreads*nthreads);
   const bool load_balance = true;
   const bool sort = true;
@@ -356,7 +361,7 @@ void FixNeighlistMeshOMP::handleTriangle(int iTri)
     // only do this if I own particles
     if(nlocal)
     {
-      if(changingMesh || changingDomain)
+      if(changingDomain)
       {
         getBinBoundariesForTriangle(iTri,ixMin,ixMax,iyMin,iyMax,izMin,izMax);
 
@@ -498,11 +498,16 @@ inline void FixWallGranOMP::post_force_eval_contact(CollisionData & cdata, doubl
         delta[0] = -cdata.delta[0];
         delta[1] = -cdata.delta[1];
         delta[2] = -cdata.delta[2];
-        #pragma omp critical
-        static_cast<FixMeshSurfaceStress*>(fix_mesh)->add_particle_contribution
-        (
-           iPart,i_forces.delta_F,delta,iTri,v_wall
-        );
+        FixMeshSurfaceStress *fix_stress = static_cast<FixMeshSurfaceStress*>(fix_mesh);
+        if(fix_stress->threadsafeContribution())
+        {
+          fix_stress->add_particle_contribution(iPart,i_forces.delta_F,delta,iTri,v_wall);
+        }
+        else
+        {
+          #pragma omp critical
+          fix_stress->add_particle_contribution(iPart,i_forces.delta_F,delta,iTri,v_wall);
+        }
     }
   }
 
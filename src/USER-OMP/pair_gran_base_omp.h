@@ -34,6 +34,7 @@
 #include "thr_omp.h"
 #include "suffix.h"
 #include "atom.h"
+#include "comm.h"
 #include "fix_contact_property_atom.h"
 
 #include <omp.h>
@@ -337,6 +338,9 @@ public:
     const bool store_contact_forces = pg->storeContactForces();
     const int freeze_group_bit = pg->freeze_group_bit();
 
+    // atoms not moved this step if fix sleep is used, NULL otherwise
+    const int * const fresh = comm->fresh_atoms();
+
     const int tid = thr->get_tid();
     std::vector<ForceUpdate> * updateList = use_patchup_list ?  &thr->patchupForceUpdates : NULL;
 
@@ -376,9 +380,15 @@ public:
       assert(ii == i); //TODO break this assumption
       assert(atom->thread[i] == tid);
       //assert(atom->in_thread_region(tid, i));
+      const bool i_asleep = fresh && !fresh[i];
 
       for (int jj = 0; jj < jnum; jj++) {
         const int j = jlist[jj] & NEIGHMASK;
+
+        // contact of two sleeping atoms does not change, skip it
+        // and leave its contact history untouched
+
+        if (i_asleep && !fresh[j]) continue;
         
         // use patchup list instead of duplicated work in conflict case
         if(j <= i && use_patchup_list) continue; 
@@ -0,0 +1,290 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+   Contributing author for SPH: Andreas Aigner (JKU Linz)
+   OpenMP version following the USER-OMP pair styles
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include <stdio.h>
+#include "pair_sph_artvisc_tenscorr_omp.h"
+#include "fix_property_atom.h"
+#include "atom.h"
+#include "comm.h"
+#include "force.h"
+#include "neighbor.h"
+#include "neigh_list.h"
+#include "error.h"
+#include "sph_kernels.h"
+#include "suffix.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+PairSphArtviscTenscorrOMP::PairSphArtviscTenscorrOMP(LAMMPS *lmp) :
+  PairSphArtviscTenscorr(lmp), ThrOMP(lmp, THR_PAIR)
+{
+  suffix_flag |= Suffix::OMP;
+  respa_enable = 0;
+  check_reduction_thr("sph/artVisc/tensCorr/omp");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairSphArtviscTenscorrOMP::compute(int eflag, int vflag)
+{
+  if (eflag || vflag) {
+    ev_setup(eflag,vflag);
+  } else evflag = vflag_fdotr = 0;
+
+  // no communication of sl, in case of perAtomType mass
+  // must be done before the threads start
+
+  if (!mass_type) {
+    fppaSl->do_forward_comm();
+    updatePtrs(); // get sl
+  }
+
+  const int nall = atom->nlocal + atom->nghost;
+  const int nthreads = comm->nthreads;
+  const int inum = list->inum;
+
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    ev_setup_thr(eflag, vflag, nall, eatom, vatom, thr);
+
+    // select the kernel once, so the pair loop is specialized for it
+
+    if (0) {}
+    #define SPH_KERNEL_CLASS
+    #define SPHKernel(kernel_id_,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+    else if (kernel_id == kernel_id_) eval_kernel<kernel_id_>(ifrom, ito, thr);
+    #include "style_sph_kernel.h"
+    #undef SPH_KERNEL_CLASS
+    #undef SPHKernel
+
+    reduce_thr(this, eflag, vflag, thr);
+  } // end of omp parallel region
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int KERNEL>
+void PairSphArtviscTenscorrOMP::eval_kernel(int ifrom, int ito, ThrData * const thr)
+{
+  if (mass_type) {
+    if (evflag) {
+      if (force->newton_pair) eval<1,1,1,KERNEL>(ifrom, ito, thr);
+      else eval<1,1,0,KERNEL>(ifrom, ito, thr);
+    } else {
+      if (force->newton_pair) eval<1,0,1,KERNEL>(ifrom, ito, thr);
+      else eval<1,0,0,KERNEL>(ifrom, ito, thr);
+    }
+  } else {
+    if (evflag) {
+      if (force->newton_pair) eval<0,1,1,KERNEL>(ifrom, ito, thr);
+      else eval<0,1,0,KERNEL>(ifrom, ito, thr);
+    } else {
+      if (force->newton_pair) eval<0,0,1,KERNEL>(ifrom, ito, thr);
+      else eval<0,0,0,KERNEL>(ifrom, ito, thr);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   same as PairSphArtviscTenscorr::compute_eval() for a range of atoms
+------------------------------------------------------------------------- */
+
+template <int MASSFLAG, int EVFLAG, int NEWTON_PAIR, int KERNEL>
+void PairSphArtviscTenscorrOMP::eval(int iifrom, int iito, ThrData * const thr)
+{
+  typedef SPH_KERNEL_NS::SPHKernelT<KERNEL> Kernel;
+
+  double sli,slCom,imass,jmass;
+  double artVisc,fAB4,rAB;
+  double rA,rB;
+  double wDeltaPinv;
+
+  double radi,rcom;
+
+  sli = radi = rcom = 0.0;
+
+  const dbl3_t * _noalias const x = (dbl3_t *) atom->x[0];
+  const dbl3_t * _noalias const v = (dbl3_t *) atom->vest[0];
+  dbl3_t * _noalias const f = (dbl3_t *) thr->get_f()[0];
+  const double * _noalias const p = atom->p;
+  const double * _noalias const rho = atom->rho;
+  const int * _noalias const type = atom->type;
+  const int * _noalias const tag = atom->tag;
+  const int nlocal = atom->nlocal;
+
+  // individual properties
+  const double * const mass = atom->mass;
+  const double * const radius = atom->radius;
+  const double * const rmass = atom->rmass;
+
+  int * const ilist = list->ilist;
+  int * const numneigh = list->numneigh;
+  int ** const firstneigh = list->firstneigh;
+
+  // loop over neighbors of my atoms
+  // depend on mass_type
+
+  for (int ii = iifrom; ii < iito; ++ii) {
+    const int i = ilist[ii];
+    const int itype = type[i];
+    const double xtmp = x[i].x;
+    const double ytmp = x[i].y;
+    const double ztmp = x[i].z;
+    int * const jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+    double fxtmp,fytmp,fztmp;
+    fxtmp=fytmp=fztmp=0.0;
+
+    const double rhoi = rho[i];
+    const double pi = p[i];
+
+    if (MASSFLAG) {
+      imass = mass[itype];
+    } else {
+      sli = sl[i];
+      radi = radius[i];
+      imass = rmass[i];
+    }
+
+    // derivative of kernel must be 0 at s = 0
+    // so particle itself is not contributing
+
+    for (int jj = 0; jj < jnum; jj++) {
+      const int j = jlist[jj];
+      const int jtype = type[j];
+
+      const double delx = xtmp - x[j].x;
+      const double dely = ytmp - x[j].y;
+      const double delz = ztmp - x[j].z;
+      const double rsq = delx*delx + dely*dely + delz*delz;
+
+      if (!MASSFLAG) {
+        const double radj = radius[j];
+        rcom = interpDist(radi,radj);
+      }
+
+      if ((MASSFLAG && rsq < cutsq[itype][jtype]) || (!MASSFLAG && rsq < rcom*rcom)) {
+
+        if (MASSFLAG) {
+          jmass = mass[jtype];
+          slCom = slComType[itype][jtype];
+        } else {
+          jmass = rmass[j];
+          const double slj = sl[j];
+          slCom = interpDist(sli,slj);
+        }
+
+        const double pj = p[j];
+        const double rhoj = rho[j];
+        const double slComInv = 1./slCom;
+
+        // get distance and normalized distance
+        const double r = sqrt(rsq);
+        if (r == 0.) {
+          char errmsg[256];
+          sprintf(errmsg,"Zero distance between SPH particles %d and %d "
+                  "at position (%f, %f, %f)",tag[i],tag[j],xtmp,ytmp,ztmp);
+          error->one(FLERR,errmsg);
+        }
+        const double rinv = 1./r;
+        const double s = r * slComInv;
+
+        // calculate value for magnitude of grad W
+        const double gradWmag = Kernel::kernel_der(s,slCom,slComInv);
+
+        // artificial viscosity [Monaghan, 1992]
+        artVisc = 0.0;
+        if (artVisc_flag) {
+          const double dotDelVDelR = ( (v[i].x-v[j].x)*delx + (v[i].y-v[j].y)*dely + (v[i].z-v[j].z)*delz );
+
+          if ( dotDelVDelR < 0.0 ) {
+            const double muAB = slCom * dotDelVDelR / (rsq + eta);
+            const double rhoMeanInv = 2/(rhoi+rhoj);
+            artVisc = ((- alphaMean[itype][jtype] * csmean[itype][jtype] * muAB + betaMean[itype][jtype] * muAB * muAB) * rhoMeanInv);
+          }
+        }
+
+        // tensile correction [Monaghan, 2000]
+        rAB = fAB4 = 0.0;
+        if (tensCorr_flag) {
+          if (pi > 0.0 && pj > 0.0) {
+            rAB = 0.01 * (pi / (rhoi * rhoi) + pj / (rhoj * rhoj));
+          } else {
+            if (pi < 0.0) rA = epsilon * -1.0 * pi / (rhoi * rhoi);
+            else rA = 0;
+            if (pj < 0.0) rB = epsilon * -1.0 * pj / (rhoj * rhoj);
+            else rB = 0;
+            rAB = rA+rB;
+          }
+
+          if (MASSFLAG) {
+            wDeltaPinv = wDeltaPTypeinv[itype][jtype];
+          } else {
+            // assumption that deltaP = sl / 1.2
+            const double deltaPOne = slCom/1.2;
+            wDeltaPinv = 1./Kernel::kernel(deltaPOne * slComInv,slCom,slComInv);
+          }
+
+          const double fAB =  Kernel::kernel(s,slCom,slComInv) * wDeltaPinv;
+          const double fAB2 = fAB * fAB;
+          fAB4 = fAB2 * fAB2;
+        }
+
+        // calculate the force
+        const double fpair = - rinv * imass * jmass * (pi/(rhoi*rhoi) + pj/(rhoj*rhoj) + rAB*fAB4 + artVisc) * gradWmag;
+
+        // apply the force
+
+        fxtmp += delx*fpair;
+        fytmp += dely*fpair;
+        fztmp += delz*fpair;
+
+        if (NEWTON_PAIR || j < nlocal) {
+          f[j].x -= delx*fpair;
+          f[j].y -= dely*fpair;
+          f[j].z -= delz*fpair;
+        }
+
+        if (EVFLAG) ev_tally_thr(this,i,j,nlocal,NEWTON_PAIR,
+                                 0.0,0.0,fpair,delx,dely,delz,thr);
+      }
+    }
+    f[i].x += fxtmp;
+    f[i].y += fytmp;
+    f[i].z += fztmp;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairSphArtviscTenscorrOMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairSphArtviscTenscorr::memory_usage();
+
+  return bytes;
+}
@@ -0,0 +1,46 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(sph/artVisc/tensCorr/omp,PairSphArtviscTenscorrOMP)
+
+#else
+
+#ifndef LMP_PAIR_SPH_ARTVISC_TENSCORR_OMP_H
+#define LMP_PAIR_SPH_ARTVISC_TENSCORR_OMP_H
+
+#include "pair_sph_artvisc_tenscorr.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairSphArtviscTenscorrOMP : public PairSphArtviscTenscorr, public ThrOMP {
+
+ public:
+  PairSphArtviscTenscorrOMP(class LAMMPS *);
+
+  virtual void compute(int, int);
+  virtual double memory_usage();
+
+ private:
+  template <int KERNEL>
+  void eval_kernel(int ifrom, int ito, ThrData * const thr);
+  template <int MASSFLAG, int EVFLAG, int NEWTON_PAIR, int KERNEL>
+  void eval(int ifrom, int ito, ThrData * const thr);
+};
+
+}
+
+#endif
+#endif
@@ -61,6 +61,21 @@ ThrOMP::~ThrOMP()
   // nothing to do?
 }
 
+/* ----------------------------------------------------------------------
+   styles that add forces to neighbor atoms j of a half neighbor list
+   let several threads write to the same atom, so they can only use
+   the per thread force arrays of 'package omp ... reduction'
+   ---------------------------------------------------------------------- */
+
+void ThrOMP::check_reduction_thr(const char *style) const
+{
+  if (!fix->use_reduction()) {
+    char str[128];
+    sprintf(str,"Style %s requires 'package omp' with keyword 'reduction'",style);
+    lmp->error->all(FLERR,str);
+  }
+}
+
 /* ----------------------------------------------------------------------
    Hook up per thread per atom arrays into the tally infrastructure
    ---------------------------------------------------------------------- */
@@ -63,6 +63,9 @@ class ThrOMP {
         THR_FIX=1<<9,THR_INTGR=1<<10};
 
  protected:
+  // styles that add forces to neighbors need per thread force arrays
+  void check_reduction_thr(const char *) const;
+
   // extra ev_tally setup work for threaded styles
   void ev_setup_thr(int, int, int, double *, double **, ThrData *);
 
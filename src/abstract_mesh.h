@@ -36,6 +36,7 @@ namespace LAMMPS_NS
       friend class FixMoveMesh;
       friend class MeshMover;
       friend class FixMeshSurfaceStressServo;
+      friend class FixMesh;
 
       public:
 
@@ -12,10 +12,14 @@
 ------------------------------------------------------------------------- */
 
 #include <stdlib.h>
+#include <string.h>
 #include "atom_vec.h"
 #include "atom.h"
 #include "force.h"
 #include "domain.h"
+#include "modify.h"
+#include "fix.h"
+#include "memory.h"
 #include "error.h"
 
 using namespace LAMMPS_NS;
@@ -29,6 +33,18 @@ AtomVec::AtomVec(LAMMPS *lmp) : Pointers(lmp)
   mass_type = dipole_type = 0;
   size_data_bonus = 0;
   cudable = false;
+
+  nfield = maxfield = 0;
+  field_size = NULL;
+  field_data = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+AtomVec::~AtomVec()
+{
+  memory->destroy(field_size);
+  memory->sfree(field_data);
 }
 
 /* ----------------------------------------------------------------------
@@ -54,6 +70,92 @@ void AtomVec::init()
     error->all(FLERR,"USER-CUDA package requires a cuda enabled atom_style");
 }
 
+/* ----------------------------------------------------------------------
+   pack data of atoms in list for sending to another proc, starting at buf[m]
+   stop before an atom if m exceeds mmax, so caller can grow buf
+   return # of atoms packed, m is advanced past the packed data
+   default is to pack one atom at a time, AtomVecs can do it in bulk
+------------------------------------------------------------------------- */
+
+int AtomVec::pack_exchange_bulk(int n, int *list, double *buf, int &m, int mmax)
+{
+  int k;
+  for (k = 0; k < n && m <= mmax; k++)
+    m += pack_exchange(list[k],&buf[m]);
+  return k;
+}
+
+/* ----------------------------------------------------------------------
+   unpack n atoms received from another proc as new owned atoms
+   offset = where the data of each atom starts in buf
+------------------------------------------------------------------------- */
+
+void AtomVec::unpack_exchange_bulk(int n, int *offset, double *buf)
+{
+  for (int k = 0; k < n; k++)
+    unpack_exchange(&buf[offset[k]]);
+}
+
+/* ----------------------------------------------------------------------
+   look up the per-atom data of fixes packed in exchange comm
+   fixes with fixed-size contiguous data are copied directly,
+     others are called back via Fix::pack_exchange() for each atom
+   must be called again after the per-atom arrays grew
+------------------------------------------------------------------------- */
+
+void AtomVec::exchange_fields()
+{
+  nfield = atom->nextra_grow;
+  if (nfield > maxfield) {
+    maxfield = nfield;
+    memory->destroy(field_size);
+    memory->sfree(field_data);
+    memory->create(field_size,maxfield,"atomvec:field_size");
+    field_data = (double **)
+      memory->smalloc(maxfield*sizeof(double *),"atomvec:field_data");
+  }
+
+  for (int iextra = 0; iextra < nfield; iextra++)
+    field_size[iextra] =
+      modify->fix[atom->extra_grow[iextra]]->exchange_field(field_data[iextra]);
+}
+
+/* ----------------------------------------------------------------------
+   pack per-atom data of fixes for atom I, same order as extra_grow
+------------------------------------------------------------------------- */
+
+int AtomVec::pack_exchange_fields(int i, double *buf)
+{
+  int m = 0;
+  for (int iextra = 0; iextra < nfield; iextra++) {
+    const int n = field_size[iextra];
+    if (n) {
+      memcpy(&buf[m],&field_data[iextra][n*i],n*sizeof(double));
+      m += n;
+    } else
+      m += modify->fix[atom->extra_grow[iextra]]->pack_exchange(i,&buf[m]);
+  }
+  return m;
+}
+
+/* ----------------------------------------------------------------------
+   unpack per-atom data of fixes for atom I
+------------------------------------------------------------------------- */
+
+int AtomVec::unpack_exchange_fields(int i, double *buf)
+{
+  int m = 0;
+  for (int iextra = 0; iextra < nfield; iextra++) {
+    const int n = field_size[iextra];
+    if (n) {
+      memcpy(&field_data[iextra][n*i],&buf[m],n*sizeof(double));
+      m += n;
+    } else
+      m += modify->fix[atom->extra_grow[iextra]]->unpack_exchange(i,&buf[m]);
+  }
+  return m;
+}
+
 /* ----------------------------------------------------------------------
    unpack one line from Velocities section of data file
 ------------------------------------------------------------------------- */
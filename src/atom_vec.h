@@ -43,7 +43,7 @@ class AtomVec : protected Pointers {
   int *maxsend;                        // CUDA-specific variable
 
   AtomVec(class LAMMPS *);
-  virtual ~AtomVec() {}
+  virtual ~AtomVec();
   virtual void settings(int, char **);
   virtual void init();
 
@@ -73,6 +73,8 @@ class AtomVec : protected Pointers {
 
   virtual int pack_exchange(int, double *) = 0;
   virtual int unpack_exchange(double *) = 0;
+  virtual int pack_exchange_bulk(int, int *, double *, int &, int);
+  virtual void unpack_exchange_bulk(int, int *, double *);
 
   virtual int size_restart() = 0;
   virtual int pack_restart(int, double *) = 0;
@@ -117,6 +119,17 @@ class AtomVec : protected Pointers {
   int deform_groupbit;
   double *h_rate;
 
+  // per-atom data of fixes in exchange comm, see exchange_fields()
+
+  int nfield;                           // # of fixes with per-atom data
+  int maxfield;                         // size of field arrays
+  int *field_size;                      // # of values/atom, 0 = fix packs it
+  double **field_data;                  // contiguous per-atom data of fix
+
+  void exchange_fields();
+  int pack_exchange_fields(int, double *);
+  int unpack_exchange_fields(int, double *);
+
   // union data struct for packing 32-bit and 64-bit ints into double bufs
   // this avoids aliasing issues by having 2 pointers (double,int)
   //   to same buf memory
@@ -36,6 +36,7 @@
 #include "memory.h"
 #include "error.h"
 #include "domain_wedge.h"
+#include "comm_precision.h"
 
 using namespace LAMMPS_NS;
 using namespace MathConst;
@@ -75,6 +76,16 @@ void AtomVecSphere::init()
   comm_x_only = 1;
   size_forward = 3;
 
+  // v/omega and f/torque are sent as floats, two per buffer slot
+  // done here and not in the constructor, since atom style hybrid sums
+  // the sizes of its sub-styles there, and its hybrid pack methods
+  // send doubles
+
+#ifdef MIXED_PRECISION_COMM_FLAG
+  size_reverse = 3;
+  size_velocity = 3;
+#endif
+
   //NP modified C.K.
   // set radvary if particle diameters are time-varying due to some fix
   for (int i = 0; i < modify->nfix; i++)
@@ -256,12 +267,7 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
         buf[m++] = x[j][0];
         buf[m++] = x[j][1];
         buf[m++] = x[j][2];
-        buf[m++] = v[j][0];
-        buf[m++] = v[j][1];
-        buf[m++] = v[j][2];
-        buf[m++] = omega[j][0];
-        buf[m++] = omega[j][1];
-        buf[m++] = omega[j][2];
+        pack_comm_vec6(buf,m,v[j],omega[j]);
       }
     } else {
       if (domain->triclinic == 0) {
@@ -279,12 +285,7 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
           buf[m++] = x[j][0] + dx;
           buf[m++] = x[j][1] + dy;
           buf[m++] = x[j][2] + dz;
-          buf[m++] = v[j][0];
-          buf[m++] = v[j][1];
-          buf[m++] = v[j][2];
-          buf[m++] = omega[j][0];
-          buf[m++] = omega[j][1];
-          buf[m++] = omega[j][2];
+          pack_comm_vec6(buf,m,v[j],omega[j]);
         }
       } else {
         dvx = pbc[0]*h_rate[0] + pbc[5]*h_rate[5] + pbc[4]*h_rate[4];
@@ -295,18 +296,10 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
           buf[m++] = x[j][0] + dx;
           buf[m++] = x[j][1] + dy;
           buf[m++] = x[j][2] + dz;
-          if (mask[i] & deform_groupbit) {
-            buf[m++] = v[j][0] + dvx;
-            buf[m++] = v[j][1] + dvy;
-            buf[m++] = v[j][2] + dvz;
-          } else {
-            buf[m++] = v[j][0];
-            buf[m++] = v[j][1];
-            buf[m++] = v[j][2];
-          }
-          buf[m++] = omega[j][0];
-          buf[m++] = omega[j][1];
-          buf[m++] = omega[j][2];
+          if (mask[i] & deform_groupbit)
+            pack_comm_vec6(buf,m,v[j][0] + dvx,v[j][1] + dvy,v[j][2] + dvz,
+                           omega[j][0],omega[j][1],omega[j][2]);
+          else pack_comm_vec6(buf,m,v[j],omega[j]);
         }
       }
     }
@@ -322,12 +315,7 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
         buf[m++] = radius[j];
         buf[m++] = rmass[j];
         buf[m++] = density[j]; //NP modified C.K.
-        buf[m++] = v[j][0];
-        buf[m++] = v[j][1];
-        buf[m++] = v[j][2];
-        buf[m++] = omega[j][0];
-        buf[m++] = omega[j][1];
-        buf[m++] = omega[j][2];
+        pack_comm_vec6(buf,m,v[j],omega[j]);
       }
     } else {
       if (domain->triclinic == 0) {
@@ -348,12 +336,7 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
           buf[m++] = radius[j];
           buf[m++] = rmass[j];
           buf[m++] = density[j]; //NP modified C.K.
-          buf[m++] = v[j][0];
-          buf[m++] = v[j][1];
-          buf[m++] = v[j][2];
-          buf[m++] = omega[j][0];
-          buf[m++] = omega[j][1];
-          buf[m++] = omega[j][2];
+          pack_comm_vec6(buf,m,v[j],omega[j]);
         }
       } else {
         dvx = pbc[0]*h_rate[0] + pbc[5]*h_rate[5] + pbc[4]*h_rate[4];
@@ -367,18 +350,10 @@ int AtomVecSphere::pack_comm_vel(int n, int *list, double *buf,
           buf[m++] = radius[j];
           buf[m++] = rmass[j];
           buf[m++] = density[j]; //NP modified C.K.
-          if (mask[i] & deform_groupbit) {
-            buf[m++] = v[j][0] + dvx;
-            buf[m++] = v[j][1] + dvy;
-            buf[m++] = v[j][2] + dvz;
-          } else {
-            buf[m++] = v[j][0];
-            buf[m++] = v[j][1];
-            buf[m++] = v[j][2];
-          }
-          buf[m++] = omega[j][0];
-          buf[m++] = omega[j][1];
-          buf[m++] = omega[j][2];
+          if (mask[i] & deform_groupbit)
+            pack_comm_vec6(buf,m,v[j][0] + dvx,v[j][1] + dvy,v[j][2] + dvz,
+                           omega[j][0],omega[j][1],omega[j][2]);
+          else pack_comm_vec6(buf,m,v[j],omega[j]);
         }
       }
     }
@@ -446,12 +421,7 @@ void AtomVecSphere::unpack_comm_vel(int n, int first, double *buf)
       x[i][0] = buf[m++];
       x[i][1] = buf[m++];
       x[i][2] = buf[m++];
-      v[i][0] = buf[m++];
-      v[i][1] = buf[m++];
-      v[i][2] = buf[m++];
-      omega[i][0] = buf[m++];
-      omega[i][1] = buf[m++];
-      omega[i][2] = buf[m++];
+      unpack_comm_vec6(buf,m,v[i],omega[i]);
       /*NL*/ //if (screen) printVec3D(screen,"FW comm: ghost x",x[i]);
     }
   } else {
@@ -464,12 +434,7 @@ void AtomVecSphere::unpack_comm_vel(int n, int first, double *buf)
       radius[i] = buf[m++];
       rmass[i] = buf[m++];
       density[i] = buf[m++]; //NP modified C.K.
-      v[i][0] = buf[m++];
-      v[i][1] = buf[m++];
-      v[i][2] = buf[m++];
-      omega[i][0] = buf[m++];
-      omega[i][1] = buf[m++];
-      omega[i][2] = buf[m++];
+      unpack_comm_vec6(buf,m,v[i],omega[i]);
     }
   }
 }
@@ -501,12 +466,7 @@ int AtomVecSphere::pack_reverse(int n, int first, double *buf)
   m = 0;
   last = first + n;
   for (i = first; i < last; i++) {
-    buf[m++] = f[i][0];
-    buf[m++] = f[i][1];
-    buf[m++] = f[i][2];
-    buf[m++] = torque[i][0];
-    buf[m++] = torque[i][1];
-    buf[m++] = torque[i][2];
+    pack_comm_vec6(buf,m,f[i],torque[i]);
   }
   return m;
 }
@@ -538,12 +498,7 @@ void AtomVecSphere::unpack_reverse(int n, int *list, double *buf)
     j = list[i];
     /*NL*/ //if (screen) fprintf(screen,"Unpacking at tag %d\n",atom->tag[j]);
     /*NL*/ //if (screen) printVec3D(screen," f_add",&buf[m]);
-    f[j][0] += buf[m++];
-    f[j][1] += buf[m++];
-    f[j][2] += buf[m++];
-    torque[j][0] += buf[m++];
-    torque[j][1] += buf[m++];
-    torque[j][2] += buf[m++];
+    unpack_add_comm_vec6(buf,m,f[j],torque[j]);
   }
 }
 
@@ -640,12 +595,7 @@ int AtomVecSphere::pack_border_vel(int n, int *list, double *buf,
       buf[m++] = radius[j];
       buf[m++] = rmass[j];
       buf[m++] = density[j]; //NP modified C.K.
-      buf[m++] = v[j][0];
-      buf[m++] = v[j][1];
-      buf[m++] = v[j][2];
-      buf[m++] = omega[j][0];
-      buf[m++] = omega[j][1];
-      buf[m++] = omega[j][2];
+      pack_comm_vec6(buf,m,v[j],omega[j]);
     }
   } else {
     if (domain->triclinic == 0) {
@@ -669,12 +619,7 @@ int AtomVecSphere::pack_border_vel(int n, int *list, double *buf,
         buf[m++] = radius[j];
         buf[m++] = rmass[j];
         buf[m++] = density[j]; //NP modified C.K.
-        buf[m++] = v[j][0];
-        buf[m++] = v[j][1];
-        buf[m++] = v[j][2];
-        buf[m++] = omega[j][0];
-        buf[m++] = omega[j][1];
-        buf[m++] = omega[j][2];
+        pack_comm_vec6(buf,m,v[j],omega[j]);
       }
     } else {
       dvx = pbc[0]*h_rate[0] + pbc[5]*h_rate[5] + pbc[4]*h_rate[4];
@@ -691,18 +636,10 @@ int AtomVecSphere::pack_border_vel(int n, int *list, double *buf,
         buf[m++] = radius[j];
         buf[m++] = rmass[j];
         buf[m++] = density[j]; //NP modified C.K.
-        if (mask[i] & deform_groupbit) {
-          buf[m++] = v[j][0] + dvx;
-          buf[m++] = v[j][1] + dvy;
-          buf[m++] = v[j][2] + dvz;
-        } else {
-          buf[m++] = v[j][0];
-          buf[m++] = v[j][1];
-          buf[m++] = v[j][2];
-        }
-        buf[m++] = omega[j][0];
-        buf[m++] = omega[j][1];
-        buf[m++] = omega[j][2];
+        if (mask[i] & deform_groupbit)
+          pack_comm_vec6(buf,m,v[j][0] + dvx,v[j][1] + dvy,v[j][2] + dvz,
+                         omega[j][0],omega[j][1],omega[j][2]);
+        else pack_comm_vec6(buf,m,v[j],omega[j]);
       }
     }
   }
@@ -777,12 +714,7 @@ void AtomVecSphere::unpack_border_vel(int n, int first, double *buf)
     radius[i] = buf[m++];
     rmass[i] = buf[m++];
     density[i] = buf[m++]; //NP modified C.K.
-    v[i][0] = buf[m++];
-    v[i][1] = buf[m++];
-    v[i][2] = buf[m++];
-    omega[i][0] = buf[m++];
-    omega[i][1] = buf[m++];
-    omega[i][2] = buf[m++];
+    unpack_comm_vec6(buf,m,v[i],omega[i]);
     /*NL*/ //if (screen) printVec3D(screen,"creating ghost at",x[i]);
   }
   if (atom->nextra_border)
@@ -808,11 +740,12 @@ int AtomVecSphere::unpack_border_hybrid(int n, int first, double *buf)
 }
 
 /* ----------------------------------------------------------------------
-   pack data for atom I for sending to another proc
-   xyz must be 1st 3 values, so comm::exchange() can test on them
+   pack the per-atom values of atom I into buf, starting at buf[1]
+   buf[0] is left for the record length
+   shared by pack_exchange() and pack_exchange_bulk()
 ------------------------------------------------------------------------- */
 
-int AtomVecSphere::pack_exchange(int i, double *buf)
+int AtomVecSphere::pack_exchange_record(int i, double *buf)
 {
   int m = 1;
   buf[m++] = x[i][0];
@@ -833,6 +766,47 @@ int AtomVecSphere::pack_exchange(int i, double *buf)
   buf[m++] = omega[i][1];
   buf[m++] = omega[i][2];
 
+  return m;
+}
+
+/* ----------------------------------------------------------------------
+   unpack the per-atom values of a record packed by pack_exchange_record()
+   into atom I, return index of first value after them
+------------------------------------------------------------------------- */
+
+int AtomVecSphere::unpack_exchange_record(int i, double *buf)
+{
+  int m = 1;
+  x[i][0] = buf[m++];
+  x[i][1] = buf[m++];
+  x[i][2] = buf[m++];
+  v[i][0] = buf[m++];
+  v[i][1] = buf[m++];
+  v[i][2] = buf[m++];
+  tag[i] = (int) ubuf(buf[m++]).i;
+  type[i] = (int) ubuf(buf[m++]).i;
+  mask[i] = (int) ubuf(buf[m++]).i;
+  image[i] = (tagint) ubuf(buf[m++]).i;
+
+  radius[i] = buf[m++];
+  rmass[i] = buf[m++];
+  density[i] = buf[m++]; //NP modified C.K.
+  omega[i][0] = buf[m++];
+  omega[i][1] = buf[m++];
+  omega[i][2] = buf[m++];
+
+  return m;
+}
+
+/* ----------------------------------------------------------------------
+   pack data for atom I for sending to another proc
+   xyz must be 1st 3 values, so comm::exchange() can test on them
+------------------------------------------------------------------------- */
+
+int AtomVecSphere::pack_exchange(int i, double *buf)
+{
+  int m = pack_exchange_record(i,buf);
+
   if (atom->nextra_grow)
     for (int iextra = 0; iextra < atom->nextra_grow; iextra++)
       m += modify->fix[atom->extra_grow[iextra]]->pack_exchange(i,&buf[m]);
@@ -848,24 +822,7 @@ int AtomVecSphere::unpack_exchange(double *buf)
   int nlocal = atom->nlocal;
   if (nlocal == nmax) grow(0);
 
-  int m = 1;
-  x[nlocal][0] = buf[m++];
-  x[nlocal][1] = buf[m++];
-  x[nlocal][2] = buf[m++];
-  v[nlocal][0] = buf[m++];
-  v[nlocal][1] = buf[m++];
-  v[nlocal][2] = buf[m++];
-  tag[nlocal] = (int) ubuf(buf[m++]).i;
-  type[nlocal] = (int) ubuf(buf[m++]).i;
-  mask[nlocal] = (int) ubuf(buf[m++]).i;
-  image[nlocal] = (tagint) ubuf(buf[m++]).i;
-
-  radius[nlocal] = buf[m++];
-  rmass[nlocal] = buf[m++];
-  density[nlocal] = buf[m++]; //NP modified C.K.
-  omega[nlocal][0] = buf[m++];
-  omega[nlocal][1] = buf[m++];
-  omega[nlocal][2] = buf[m++];
+  int m = unpack_exchange_record(nlocal,buf);
 
   if (atom->nextra_grow)
     for (int iextra = 0; iextra < atom->nextra_grow; iextra++)
@@ -876,6 +833,49 @@ int AtomVecSphere::unpack_exchange(double *buf)
   return m;
 }
 
+/* ----------------------------------------------------------------------
+   pack data of atoms in list for sending to another proc, starting at buf[m]
+   same layout as pack_exchange(), but fix data with a fixed size is
+     copied directly instead of via per-atom callbacks
+------------------------------------------------------------------------- */
+
+int AtomVecSphere::pack_exchange_bulk(int n, int *list, double *buf,
+                                      int &m, int mmax)
+{
+  if (n == 0) return 0;
+  exchange_fields();
+
+  int k;
+  for (k = 0; k < n && m <= mmax; k++) {
+    const int i = list[k];
+    double *rec = &buf[m];
+    int j = pack_exchange_record(i,rec);
+    j += pack_exchange_fields(i,&rec[j]);
+    rec[0] = j;
+    m += j;
+  }
+  return k;
+}
+
+/* ----------------------------------------------------------------------
+   unpack n atoms received from another proc, grow arrays only once
+------------------------------------------------------------------------- */
+
+void AtomVecSphere::unpack_exchange_bulk(int n, int *offset, double *buf)
+{
+  if (n == 0) return;
+  if (atom->nlocal + n > nmax) grow(atom->nlocal + n);
+  exchange_fields();
+
+  for (int k = 0; k < n; k++) {
+    const int i = atom->nlocal;
+    double *rec = &buf[offset[k]];
+    int j = unpack_exchange_record(i,rec);
+    unpack_exchange_fields(i,&rec[j]);
+    atom->nlocal++;
+  }
+}
+
 /* ----------------------------------------------------------------------
    size of restart data for all atoms owned by this proc
    include extra data stored by fixes
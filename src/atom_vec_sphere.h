@@ -64,6 +64,8 @@ class AtomVecSphere : public AtomVec {
   int unpack_border_hybrid(int, int, double *);
   int pack_exchange(int, double *);
   int unpack_exchange(double *);
+  int pack_exchange_bulk(int, int *, double *, int &, int);
+  void unpack_exchange_bulk(int, int *, double *);
   int size_restart();
   int pack_restart(int, double *);
   int unpack_restart(double *);
@@ -85,6 +87,9 @@ class AtomVecSphere : public AtomVec {
   bigint memory_usage();
 
  protected:
+  int pack_exchange_record(int, double *);
+  int unpack_exchange_record(int, double *);
+
   int *tag,*type,*mask;
   tagint *image;
   double **x,**v,**f;
@@ -60,6 +60,11 @@ Balance::Balance(LAMMPS *lmp) : Pointers(lmp)
   user_xsplit = user_ysplit = user_zsplit = NULL;
   dflag = 0;
 
+  npredict = maxpredict = 0;
+  predict_lo = predict_hi = NULL;
+  predict_n = NULL;
+  npredict_total = 0;
+
   fp = NULL;
   firststep = 1;
 }
@@ -71,6 +76,10 @@ Balance::~Balance()
   memory->destroy(proccount);
   memory->destroy(allproccount);
 
+  memory->destroy(predict_lo);
+  memory->destroy(predict_hi);
+  memory->destroy(predict_n);
+
   delete [] user_xsplit;
   delete [] user_ysplit;
   delete [] user_zsplit;
@@ -397,9 +406,25 @@ void Balance::command(int narg, char **arg)
 
 double Balance::imbalance_nlocal(int &max)
 {
-  MPI_Allreduce(&atom->nlocal,&max,1,MPI_INT,MPI_MAX,world);
+  int nlocal = atom->nlocal;
+
+  // add my share of predicted particles
+
+  if (npredict) {
+    int *myloc = comm->myloc;
+    double extra = 0.0;
+    for (int k = 0; k < npredict; k++)
+      extra += predict_n[k] *
+        predicted_fraction(k,X,comm->xsplit[myloc[0]],comm->xsplit[myloc[0]+1]) *
+        predicted_fraction(k,Y,comm->ysplit[myloc[1]],comm->ysplit[myloc[1]+1]) *
+        predicted_fraction(k,Z,comm->zsplit[myloc[2]],comm->zsplit[myloc[2]+1]);
+    nlocal += static_cast<int> (extra + 0.5);
+  }
+
+  MPI_Allreduce(&nlocal,&max,1,MPI_INT,MPI_MAX,world);
+  bigint natoms = atom->natoms + npredict_total;
   double imbalance = 1.0;
-  if (max) imbalance = max / (1.0 * atom->natoms / nprocs);
+  if (max && natoms) imbalance = max / (1.0 * natoms / nprocs);
   return imbalance;
 }
 
@@ -435,10 +460,23 @@ double Balance::imbalance_splits(int &max)
   }
 
   MPI_Allreduce(proccount,allproccount,nprocs,MPI_INT,MPI_SUM,world);
+
+  // add predicted particles, identical on all procs
+
+  for (int k = 0; k < npredict; k++)
+    for (iz = 0; iz < nz; iz++)
+      for (iy = 0; iy < ny; iy++)
+        for (ix = 0; ix < nx; ix++)
+          allproccount[iz*nx*ny + iy*nx + ix] += static_cast<int> (predict_n[k] *
+            predicted_fraction(k,X,xsplit[ix],xsplit[ix+1]) *
+            predicted_fraction(k,Y,ysplit[iy],ysplit[iy+1]) *
+            predicted_fraction(k,Z,zsplit[iz],zsplit[iz+1]) + 0.5);
+
   max = 0;
   for (int i = 0; i < nprocs; i++) max = MAX(max,allproccount[i]);
+  bigint natoms = atom->natoms + npredict_total;
   double imbalance = 1.0;
-  if (max) imbalance = max / (1.0 * atom->natoms / nprocs);
+  if (max && natoms) imbalance = max / (1.0 * natoms / nprocs);
   return imbalance;
 }
 
@@ -502,8 +540,9 @@ int Balance::dynamic()
   double *split = NULL, *split_old = NULL; //NP modified C.K.
 
   // no balancing if no atoms
+  // predicted particles count as atoms, so can balance an empty box
 
-  bigint natoms = atom->natoms;
+  bigint natoms = atom->natoms + npredict_total;
   if (natoms == 0) return 0;
 
   // set delta for 1d balancing = root of threshhold
@@ -711,6 +750,20 @@ void Balance::tally(int dim, int n, double *split)
   sum[0] = 0;
   for (int i = 1; i < n+1; i++)
     sum[i] = sum[i-1] + count[i-1];
+
+  // add predicted particles below each split
+  // use cummulative sum so that sum[n] matches natoms exactly
+
+  if (npredict) {
+    for (int i = 1; i < n+1; i++) {
+      double extra = 0.0;
+      for (int k = 0; k < npredict; k++)
+        extra += predict_n[k] * predicted_fraction(k,dim,0.0,split[i]);
+      sum[i] += static_cast<bigint> (extra + 0.5);
+    }
+    for (int i = 0; i < n; i++)
+      count[i] = sum[i+1] - sum[i];
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -763,7 +816,8 @@ int Balance::adjust(int n, double *split)
   for (int i = 1; i < n; i++)
     if (sum[i] != target[i]) {
       change = 1;
-      if (rho == 0) split[i] = 0.5 * (lo[i]+hi[i]);
+      // bisect if no particles between lo/hi, e.g. empty sub-domains
+      if (rho == 0 || hisum[i] == losum[i]) split[i] = 0.5 * (lo[i]+hi[i]);
       else {
         fraction = 1.0*(target[i]-losum[i]) / (hisum[i]-losum[i]);
         split[i] = lo[i] + fraction * (hi[i]-lo[i]);
@@ -772,6 +826,74 @@ int Balance::adjust(int n, double *split)
   return change;
 }
 
+/* ----------------------------------------------------------------------
+   add N particles that are predicted to appear in box lo/hi
+   particles are assumed to be spread evenly over the box
+   must be called with identical args on all procs
+------------------------------------------------------------------------- */
+
+void Balance::add_prediction(double *boxlo, double *boxhi, bigint n)
+{
+  if (n <= 0) return;
+
+  if (npredict == maxpredict) {
+    maxpredict += 4;
+    memory->grow(predict_lo,maxpredict,3,"balance:predict_lo");
+    memory->grow(predict_hi,maxpredict,3,"balance:predict_hi");
+    memory->grow(predict_n,maxpredict,"balance:predict_n");
+  }
+
+  // store in lamda coords, clipped to box
+  // give flat volumes (e.g. insertion faces) a small finite extent
+
+  double *plo = predict_lo[npredict];
+  double *phi = predict_hi[npredict];
+  domain->x2lamda(boxlo,plo);
+  domain->x2lamda(boxhi,phi);
+
+  for (int dim = 0; dim < 3; dim++) {
+    if (plo[dim] > phi[dim]) {
+      double tmp = plo[dim];
+      plo[dim] = phi[dim];
+      phi[dim] = tmp;
+    }
+    plo[dim] = MIN(MAX(plo[dim],0.0),1.0);
+    phi[dim] = MIN(MAX(phi[dim],0.0),1.0);
+    if (phi[dim] - plo[dim] < 1.0e-6) {
+      double mid = 0.5 * (plo[dim]+phi[dim]);
+      plo[dim] = MAX(mid-0.5e-6,0.0);
+      phi[dim] = MIN(mid+0.5e-6,1.0);
+    }
+  }
+
+  predict_n[npredict] = n;
+  npredict_total += n;
+  npredict++;
+}
+
+/* ----------------------------------------------------------------------
+   remove all predicted particles
+------------------------------------------------------------------------- */
+
+void Balance::clear_prediction()
+{
+  npredict = 0;
+  npredict_total = 0;
+}
+
+/* ----------------------------------------------------------------------
+   fraction of predicted volume K between lamda coords lo/hi in dim
+------------------------------------------------------------------------- */
+
+double Balance::predicted_fraction(int k, int dim, double slo, double shi)
+{
+  double plo = predict_lo[k][dim];
+  double phi = predict_hi[k][dim];
+  double overlap = MIN(phi,shi) - MAX(plo,slo);
+  if (overlap <= 0.0) return 0.0;
+  return overlap / (phi-plo);
+}
+
 /* ----------------------------------------------------------------------
    OLD code: for local diffusion method that didn't work as well as RCB
    adjust cuts between N slices in a dim via diffusive method
@@ -45,6 +45,10 @@ class Balance : protected Pointers {
   double imbalance_nlocal(int &);
   void dumpout(bigint, FILE *);
 
+  // particles predicted to be inserted, e.g. by fix insert
+  void add_prediction(double *, double *, bigint);
+  void clear_prediction();
+
   bool disallow_irregular();   //NP modified C.K.
 
  private:
@@ -72,6 +76,12 @@ class Balance : protected Pointers {
   int *proccount;            // particle count per processor
   int *allproccount;
 
+  int npredict,maxpredict;   // # of predicted insertion volumes
+  double **predict_lo;       // lamda bounds of predicted insertion volumes
+  double **predict_hi;
+  bigint *predict_n;         // # of particles predicted for each volume
+  bigint npredict_total;     // sum of predict_n
+
   int outflag;               // for output of balance results to file
   FILE *fp;
   int firststep;
@@ -82,6 +92,7 @@ class Balance : protected Pointers {
   int adjust(int, double *);
   void old_adjust(int, int, bigint *, double *);
   int binary(double, int, double *);
+  double predicted_fraction(int, int, double, double);
   void debug_output(int, int, int, double *);
 };
 
@@ -51,7 +51,11 @@
 #include "math_extra.h"
 #include "error.h"
 #include "memory.h"
+#include "update.h"
 #include "fix_insert.h"
+#include "fix_sleep.h"
+#include "fix_property_atom.h"
+#include "trace.h"
 
 #ifdef _OPENMP
 #include "omp.h"
@@ -62,6 +66,7 @@ using namespace LAMMPS_NS;
 #define BUFFACTOR 1.5
 #define BUFMIN 1000
 #define BUFEXTRA 1000
+#define SLEEPHEADER 4   // max overhead of run headers in forward_comm_sleep()
 #define BIG 1.0e20
 
 enum{SINGLE,MULTI};
@@ -95,6 +100,18 @@ Comm::Comm(LAMMPS *lmp) : Pointers(lmp)
 
   grid2proc = NULL;
 
+  fix_sleep = NULL;
+  fresh = NULL;
+  maxfresh = 0;
+  exlist = NULL;
+  maxexlist = 0;
+  freshstep = -1;
+  fix_group_size = NULL;
+  fix_group_list = NULL;
+  maxfixgroup = 0;
+  fix_registered = NULL;
+  nregistered = maxregistered = 0;
+
   bordergroup = 0;
   style = SINGLE;
   uniform = 1;
@@ -168,6 +185,12 @@ Comm::~Comm()
   delete [] customfile;
   delete [] outfile;
 
+  memory->destroy(fresh);
+  memory->destroy(fix_group_size);
+  memory->sfree(fix_group_list);
+  memory->sfree(fix_registered);
+  memory->destroy(exlist);
+
   memory->destroy(grid2proc);
 
   free_swap();
@@ -359,6 +382,13 @@ void Comm::init()
   for (int i = 0; i < modify->nfix; i++)
     size_border += modify->fix[i]->comm_border;
 
+  // fix sleep marks atoms whose ghosts need no forward comm
+
+  fix_sleep = NULL;
+  for (int i = 0; i < modify->nfix; i++)
+    if (strcmp(modify->fix[i]->style,"sleep") == 0)
+      fix_sleep = static_cast<FixSleep*>(modify->fix[i]);
+
   // maxexchange = max # of datums/atom in exchange communication
   // maxforward = # of datums in largest forward communication
   // maxreverse = # of datums in largest reverse communication
@@ -752,6 +782,8 @@ int Comm::updown(int dim, int dir, int loc,
 
 void Comm::forward_comm(int dummy)
 {
+  TRACE_REGION("Comm::forward_comm");
+
   int n;
   MPI_Request request;
   MPI_Status status;
@@ -759,6 +791,14 @@ void Comm::forward_comm(int dummy)
   double **x = atom->x;
   double *buf;
 
+  // only send atoms that are not asleep
+  // sleeping atoms do not move, so ghost coords stay valid unless box changes
+
+  if (fix_sleep && !domain->box_change) {
+    forward_comm_sleep();
+    return;
+  }
+
   // exchange data with another proc
   // if other proc is self, just copy
   // if comm_x_only set, exchange or copy directly to x, don't unpack
@@ -814,6 +854,126 @@ void Comm::forward_comm(int dummy)
   }
 }
 
+/* ----------------------------------------------------------------------
+   forward communication of atom coords, only for atoms that are awake
+   atom is fresh if it is owned and awake, or if it was received in a
+     previous swap of this forward comm
+   each swap sends runs of consecutive fresh atoms in sendlist
+   other ghosts keep the values of the last forward comm
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_sleep()
+{
+  int n;
+  MPI_Request request;
+  MPI_Status status;
+
+  if (atom->nmax > maxfresh) {
+    maxfresh = atom->nmax;
+    memory->destroy(fresh);
+    memory->create(fresh,maxfresh,"comm:fresh");
+  }
+
+  int nlocal = atom->nlocal;
+  for (int i = 0; i < nlocal; i++)
+    fresh[i] = fix_sleep->asleep(i) ? 0 : 1;
+  freshstep = update->ntimestep;
+
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    if (sendproc[iswap] != me) {
+      if (recvnum[iswap])
+        MPI_Irecv(buf_recv,maxrecv,MPI_DOUBLE,recvproc[iswap],0,world,&request);
+      n = pack_comm_sleep(iswap,buf_send);
+      if (sendnum[iswap]) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+      if (recvnum[iswap]) {
+        MPI_Wait(&request,&status);
+        unpack_comm_sleep(iswap,buf_recv);
+      }
+    } else {
+      pack_comm_sleep(iswap,buf_send);
+      unpack_comm_sleep(iswap,buf_send);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   flags of owned and ghost atoms, 0 if asleep, i.e. not moved this step
+   NULL unless the forward comm of this step skipped sleeping atoms,
+     e.g. on reneighboring steps, so ghost sleep states are unknown
+------------------------------------------------------------------------- */
+
+const int *Comm::fresh_atoms() const
+{
+  if (fix_sleep && freshstep == update->ntimestep) return fresh;
+  return NULL;
+}
+
+/* ----------------------------------------------------------------------
+   pack runs of fresh atoms of a swap
+   buf = # of runs, then per run: 1st index in sendlist, # of atoms,
+     # of datums, packed atoms
+   return # of datums in buf
+------------------------------------------------------------------------- */
+
+int Comm::pack_comm_sleep(int iswap, double *buf)
+{
+  AtomVec *avec = atom->avec;
+  int *list = sendlist[iswap];
+  int nsend = sendnum[iswap];
+
+  int nruns = 0;
+  int m = 1;
+  int i = 0;
+  while (i < nsend) {
+    if (!fresh[list[i]]) {
+      i++;
+      continue;
+    }
+    int start = i;
+    while (i < nsend && fresh[list[i]]) i++;
+
+    int n;
+    if (ghost_velocity)
+      n = avec->pack_comm_vel(i-start,&list[start],&buf[m+3],
+                              pbc_flag[iswap],pbc[iswap]);
+    else
+      n = avec->pack_comm(i-start,&list[start],&buf[m+3],
+                          pbc_flag[iswap],pbc[iswap]);
+    buf[m] = static_cast<double> (start);
+    buf[m+1] = static_cast<double> (i-start);
+    buf[m+2] = static_cast<double> (n);
+    m += 3 + n;
+    nruns++;
+  }
+  buf[0] = static_cast<double> (nruns);
+  return m;
+}
+
+/* ----------------------------------------------------------------------
+   unpack runs of fresh atoms of a swap into ghosts, mark them fresh
+------------------------------------------------------------------------- */
+
+void Comm::unpack_comm_sleep(int iswap, double *buf)
+{
+  AtomVec *avec = atom->avec;
+  int first = firstrecv[iswap];
+  int last = first + recvnum[iswap];
+
+  for (int i = first; i < last; i++) fresh[i] = 0;
+
+  int nruns = static_cast<int> (buf[0]);
+  int m = 1;
+  for (int irun = 0; irun < nruns; irun++) {
+    int start = static_cast<int> (buf[m]);
+    int n = static_cast<int> (buf[m+1]);
+    int size = static_cast<int> (buf[m+2]);
+    if (ghost_velocity) avec->unpack_comm_vel(n,first+start,&buf[m+3]);
+    else avec->unpack_comm(n,first+start,&buf[m+3]);
+    for (int i = first+start; i < first+start+n; i++) fresh[i] = 1;
+    m += 3 + size;
+  }
+}
+
 /* ----------------------------------------------------------------------
    reverse communication of forces on atoms every timestep
    other per-atom attributes may also be sent via pack/unpack routines
@@ -821,6 +981,8 @@ void Comm::forward_comm(int dummy)
 
 void Comm::reverse_comm()
 {
+  TRACE_REGION("Comm::reverse_comm");
+
   int n;
   MPI_Request request;
   MPI_Status status;
@@ -880,7 +1042,9 @@ void Comm::reverse_comm()
 
 void Comm::exchange()
 {
-  int i,m,nsend,nrecv,nrecv1,nrecv2,nlocal;
+  TRACE_REGION("Comm::exchange");
+
+  int i,k,m,nsend,nrecv,nrecv1,nrecv2,nlocal,nexch;
   double lo,hi,value;
   double **x;
   double *sublo,*subhi,*buf;
@@ -898,6 +1062,11 @@ void Comm::exchange()
   atom->nghost = 0;
   atom->avec->clear_bonus();
 
+  // atoms are re-sorted, fresh flags of last forward_comm_sleep() are void
+  // setup() of a follow-up run reneighbors on the same timestep
+
+  freshstep = -1;
+
   // insure send buf is large enough for single atom
   // fixes can change per-atom size requirement on-the-fly
 
@@ -921,22 +1090,35 @@ void Comm::exchange()
 
   for (int dim = 0; dim < 3; dim++) {
 
-    // fill buffer with atoms leaving my box, using < and >=
-    // when atom is deleted, fill it in with last atom
+    // list atoms leaving my box, using < and >=
 
     x = atom->x;
     lo = sublo[dim];
     hi = subhi[dim];
     nlocal = atom->nlocal;
-    i = nsend = 0;
+    nexch = 0;
 
-    while (i < nlocal) {
+    for (i = 0; i < nlocal; i++)
       if (x[i][dim] < lo || x[i][dim] >= hi) {
-        if (nsend > maxsend) grow_send(nsend,1);
-        nsend += avec->pack_exchange(i,&buf_send[nsend]);
-        avec->copy(nlocal-1,i,1);
-        nlocal--;
-      } else i++;
+        if (nexch == maxexlist) grow_exlist(nexch+1);
+        exlist[nexch++] = i;
+      }
+
+    // fill buffer with leaving atoms in bulk
+    // AtomVec stops packing once the buffer is full, grow and continue
+
+    k = nsend = 0;
+    while (k < nexch) {
+      k += avec->pack_exchange_bulk(nexch-k,&exlist[k],buf_send,nsend,maxsend);
+      if (k < nexch) grow_send(nsend,1);
+    }
+
+    // delete leaving atoms, fill each one in with last atom
+    // going backwards, the last atom is never one that is leaving
+
+    for (k = nexch-1; k >= 0; k--) {
+      avec->copy(nlocal-1,exlist[k],1);
+      nlocal--;
     }
     atom->nlocal = nlocal;
 
@@ -978,12 +1160,16 @@ void Comm::exchange()
     // check incoming atoms to see if they are in my box
     // if so, add to my list
 
-    m = 0;
+    m = nexch = 0;
     while (m < nrecv) {
       value = buf[m+dim+1];
-      if (value >= lo && value < hi) m += avec->unpack_exchange(&buf[m]);
-      else m += static_cast<int> (buf[m]);
+      if (value >= lo && value < hi) {
+        if (nexch == maxexlist) grow_exlist(nexch+1);
+        exlist[nexch++] = m;
+      }
+      m += static_cast<int> (buf[m]);
     }
+    avec->unpack_exchange_bulk(nexch,exlist,buf);
   }
 
   //NP modified C.K.
@@ -1007,6 +1193,8 @@ void Comm::exchange()
 
 void Comm::borders()
 {
+  TRACE_REGION("Comm::borders");
+
   int i,n,itype,iswap,dim,ineed,twoneed,smax,rmax;
   int nsend,nrecv,sendflag,nfirst,nlast,ngroup;
   double lo = 0.0,hi = 0.0;
@@ -1017,6 +1205,10 @@ void Comm::borders()
   MPI_Status status;
   AtomVec *avec = atom->avec;
 
+  // ghosts are re-created, fresh flags of last forward_comm_sleep() are void
+
+  freshstep = -1;
+
   // do swaps over all 3 dimensions
 
   nfirst = 0;
@@ -1211,6 +1403,7 @@ void Comm::borders()
   int max = MAX(maxforward*smax,maxreverse*rmax);
   if (max > maxsend) grow_send(max,0);
   max = MAX(maxforward*rmax,maxreverse*smax);
+  if (fix_sleep) max += SLEEPHEADER;
   if (max > maxrecv) grow_recv(max);
 
   // reset global->local map
@@ -1366,6 +1559,239 @@ void Comm::reverse_comm_fix(Fix *fix)
   }
 }
 
+/* ----------------------------------------------------------------------
+   scratch list for callers to collect a group of n Fixes in
+   valid until the next call with a larger n
+------------------------------------------------------------------------- */
+
+Fix **Comm::fix_group(int nfix)
+{
+  if (nfix > maxfixgroup) {
+    maxfixgroup = nfix;
+    memory->destroy(fix_group_size);
+    memory->create(fix_group_size,maxfixgroup,"comm:fix_group_size");
+    memory->sfree(fix_group_list);
+    fix_group_list = (Fix **)
+      memory->smalloc(maxfixgroup*sizeof(Fix *),"comm:fix_group_list");
+  }
+  return fix_group_list;
+}
+
+/* ----------------------------------------------------------------------
+   defer the forward comm of a property to forward_comm_registered()
+   used by fixes whose ghost values are not needed before the end of
+   the current integration phase, so the properties of all these fixes
+   are sent in one message per swap
+   a property registered more than once is sent once
+------------------------------------------------------------------------- */
+
+void Comm::register_forward_fix(FixPropertyAtom *fix)
+{
+  for (int i = 0; i < nregistered; i++)
+    if (fix_registered[i] == fix) return;
+
+  if (nregistered == maxregistered) {
+    maxregistered += 4;
+    fix_registered = (FixPropertyAtom **)
+      memory->srealloc(fix_registered,maxregistered*sizeof(FixPropertyAtom *),
+                       "comm:fix_registered");
+  }
+  fix_registered[nregistered++] = fix;
+}
+
+/* ----------------------------------------------------------------------
+   forward comm of all properties registered since the last call
+   invoked by Modify once all fixes of an integration phase are done
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_registered()
+{
+  if (nregistered == 0) return;
+  FixPropertyAtom::do_forward_comm(nregistered,fix_registered);
+  nregistered = 0;
+}
+
+/* ----------------------------------------------------------------------
+   forward communication invoked by a group of Fixes
+   data of all fixes is sent in one message per swap
+   n = constant number of datums per atom for each fix
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_fix_group(int nfix, Fix **fixes)
+{
+  int iswap,ifix,m,size;
+  double *buf;
+  MPI_Request request;
+  MPI_Status status;
+
+  grow_fix_group(nfix,fixes,0);
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+
+    // pack buffer, data of each fix follows the one of the previous fix
+
+    m = 0;
+    for (ifix = 0; ifix < nfix; ifix++) {
+      fix_group_size[ifix] = fixes[ifix]->pack_comm(sendnum[iswap],sendlist[iswap],
+                                 &buf_send[m],pbc_flag[iswap],pbc[iswap]);
+      m += fix_group_size[ifix]*sendnum[iswap];
+    }
+
+    size = 0;
+    for (ifix = 0; ifix < nfix; ifix++) size += fix_group_size[ifix];
+
+    // exchange with another proc
+    // if self, set recv buffer to send buffer
+
+    if (sendproc[iswap] != me) {
+      if (recvnum[iswap])
+        MPI_Irecv(buf_recv,size*recvnum[iswap],MPI_DOUBLE,recvproc[iswap],0,
+                  world,&request);
+      if (sendnum[iswap])
+        MPI_Send(buf_send,m,MPI_DOUBLE,sendproc[iswap],0,world);
+      if (recvnum[iswap]) MPI_Wait(&request,&status);
+      buf = buf_recv;
+    } else buf = buf_send;
+
+    // unpack buffer
+
+    m = 0;
+    for (ifix = 0; ifix < nfix; ifix++) {
+      fixes[ifix]->unpack_comm(recvnum[iswap],firstrecv[iswap],&buf[m]);
+      m += fix_group_size[ifix]*recvnum[iswap];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   reverse communication invoked by a group of Fixes
+   data of all fixes is sent in one message per swap
+   n = constant number of datums per atom for each fix
+------------------------------------------------------------------------- */
+
+void Comm::reverse_comm_fix_group(int nfix, Fix **fixes)
+{
+  int iswap,ifix,m,size;
+  double *buf;
+  MPI_Request request;
+  MPI_Status status;
+
+  grow_fix_group(nfix,fixes,1);
+
+  for (iswap = nswap-1; iswap >= 0; iswap--) {
+
+    // pack buffer, data of each fix follows the one of the previous fix
+
+    m = 0;
+    for (ifix = 0; ifix < nfix; ifix++) {
+      fix_group_size[ifix] =
+        fixes[ifix]->pack_reverse_comm(recvnum[iswap],firstrecv[iswap],&buf_send[m]);
+      m += fix_group_size[ifix]*recvnum[iswap];
+    }
+
+    size = 0;
+    for (ifix = 0; ifix < nfix; ifix++) size += fix_group_size[ifix];
+
+    // exchange with another proc
+    // if self, set recv buffer to send buffer
+
+    if (sendproc[iswap] != me) {
+      if (sendnum[iswap])
+        MPI_Irecv(buf_recv,size*sendnum[iswap],MPI_DOUBLE,sendproc[iswap],0,
+                  world,&request);
+      if (recvnum[iswap])
+        MPI_Send(buf_send,m,MPI_DOUBLE,recvproc[iswap],0,world);
+      if (sendnum[iswap]) MPI_Wait(&request,&status);
+      buf = buf_recv;
+    } else buf = buf_send;
+
+    // unpack buffer
+
+    m = 0;
+    for (ifix = 0; ifix < nfix; ifix++) {
+      fixes[ifix]->unpack_reverse_comm(sendnum[iswap],sendlist[iswap],&buf[m]);
+      m += fix_group_size[ifix]*sendnum[iswap];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   insure send/recv buffers fit the data of a group of Fixes
+   buffers set up by init() only fit the largest single Fix
+   reverseflag = 1 for reverse comm
+------------------------------------------------------------------------- */
+
+void Comm::grow_fix_group(int nfix, Fix **fixes, int reverseflag, int nheader)
+{
+  int iswap,ifix;
+
+  // fixes may be the scratch list, which is large enough already
+
+  fix_group(nfix);
+
+  int size = 0;
+  for (ifix = 0; ifix < nfix; ifix++)
+    size += reverseflag ? fixes[ifix]->comm_reverse : fixes[ifix]->comm_forward;
+
+  int nsend = 0, nrecv = 0;
+  for (iswap = 0; iswap < nswap; iswap++) {
+    nsend = MAX(nsend,reverseflag ? recvnum[iswap] : sendnum[iswap]);
+    nrecv = MAX(nrecv,reverseflag ? sendnum[iswap] : recvnum[iswap]);
+  }
+
+  if (size*nsend+nheader > maxsend) grow_send(size*nsend+nheader,0);
+  if (size*nrecv+nheader > maxrecv) grow_recv(size*nrecv+nheader);
+}
+
+/* ----------------------------------------------------------------------
+   forward communication invoked by a group of Fixes
+   data of all fixes is sent in one message per swap
+   n = total datums for all atoms of each fix, allows for variable number/atom
+   the message starts with the n of each fix, so it can be split on receipt
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_variable_fix_group(int nfix, Fix **fixes)
+{
+  int iswap,ifix,m,n;
+  double *buf;
+  MPI_Request request;
+  MPI_Status status;
+
+  grow_fix_group(nfix,fixes,0,nfix);
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+
+    // pack buffer, header with size of data of each fix first
+
+    m = nfix;
+    for (ifix = 0; ifix < nfix; ifix++) {
+      n = fixes[ifix]->pack_comm(sendnum[iswap],sendlist[iswap],
+                                 &buf_send[m],pbc_flag[iswap],pbc[iswap]);
+      buf_send[ifix] = static_cast<double>(n);
+      m += n;
+    }
+
+    // exchange with another proc
+    // if self, set recv buffer to send buffer
+
+    if (sendproc[iswap] != me) {
+      MPI_Irecv(buf_recv,maxrecv,MPI_DOUBLE,recvproc[iswap],0,
+                world,&request);
+      MPI_Send(buf_send,m,MPI_DOUBLE,sendproc[iswap],0,world);
+      MPI_Wait(&request,&status);
+      buf = buf_recv;
+    } else buf = buf_send;
+
+    // unpack buffer
+
+    m = nfix;
+    for (ifix = 0; ifix < nfix; ifix++) {
+      fixes[ifix]->unpack_comm(recvnum[iswap],firstrecv[iswap],&buf[m]);
+      m += static_cast<int> (buf[ifix]);
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    forward communication invoked by a Fix
    n = total datums for all atoms, allows for variable number/atom
@@ -1777,6 +2203,16 @@ void Comm::grow_recv(int n)
   memory->create(buf_recv,maxrecv,"comm:buf_recv");
 }
 
+/* ----------------------------------------------------------------------
+   realloc the size of the exchange list as needed with BUFFACTOR
+------------------------------------------------------------------------- */
+
+void Comm::grow_exlist(int n)
+{
+  maxexlist = static_cast<int> (BUFFACTOR * n);
+  memory->grow(exlist,maxexlist,"comm:exlist");
+}
+
 /* ----------------------------------------------------------------------
    realloc the size of the iswap sendlist as needed with BUFFACTOR
 ------------------------------------------------------------------------- */
@@ -65,6 +65,12 @@ class Comm : protected Pointers {
   virtual void reverse_comm_pair(class Pair *);    // reverse comm from a Pair
   virtual void forward_comm_fix(class Fix *);      // forward comm from a Fix
   virtual void reverse_comm_fix(class Fix *);      // reverse comm from a Fix
+  class Fix **fix_group(int);                      // scratch list for a group
+  void forward_comm_fix_group(int, class Fix **);  // forward comm from Fixes
+  void reverse_comm_fix_group(int, class Fix **);  // reverse comm from Fixes
+  void forward_comm_variable_fix_group(int, class Fix **); // variable-size
+  void register_forward_fix(class FixPropertyAtom *); // defer forward comm
+  void forward_comm_registered();                  // send deferred ones at once
   virtual void forward_comm_variable_fix(class Fix *); // variable-size variant
   virtual void reverse_comm_variable_fix(class Fix *); // variable-size variant
   virtual void forward_comm_compute(class Compute *);  // forward from a Compute
@@ -73,6 +79,8 @@ class Comm : protected Pointers {
   virtual void reverse_comm_dump(class Dump *);    // reverse comm from a Dump
   void forward_comm_array(int, double **);         // forward comm of array
 
+  const int *fresh_atoms() const;   // owned+ghost atoms that moved this step
+
   void ring(int, int, void *, int, void (*)(int, char *),   // ring comm
             void *, int self = 1);
   int read_lines_from_file(FILE *, int, int, char *);  // read/bcast file lines
@@ -135,8 +143,27 @@ class Comm : protected Pointers {
 
   int updown(int, int, int, double, int, double *);
                                             // compare cutoff to procs
+  class FixSleep *fix_sleep;        // sleeping atoms are not forward comm
+  int *fresh;                       // 1 if atom was updated in this forward comm
+  int maxfresh;                     // size of fresh array
+  bigint freshstep;                 // timestep of last forward_comm_sleep()
+  int *fix_group_size;              // datums per atom of each Fix in a group
+  class Fix **fix_group_list;       // scratch list returned by fix_group()
+  int maxfixgroup;                  // size of fix_group_size/list arrays
+  class FixPropertyAtom **fix_registered; // fixes waiting for forward comm
+  int nregistered,maxregistered;    // # of them, size of fix_registered
+  int *exlist;                      // atoms leaving / records accepted in exchange
+  int maxexlist;                    // size of exlist
+
+  void forward_comm_sleep();                // forward comm of awake atoms
+  int pack_comm_sleep(int, double *);
+  void unpack_comm_sleep(int, double *);
+
   virtual void grow_send(int,int);          // reallocate send buffer
   virtual void grow_recv(int);              // free/allocate recv buffer
+  void grow_exlist(int);                    // reallocate exchange list
+  void grow_fix_group(int, class Fix **, int, int nheader = 0);
+                                            // fit buffers to a Fix group
   virtual void grow_list(int, int);         // reallocate one sendlist
   virtual void grow_swap(int);              // grow swap and multi arrays
   virtual void allocate_swap(int);          // allocate swap arrays
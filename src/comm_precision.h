@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_COMM_PRECISION_H
+#define LMP_COMM_PRECISION_H
+
+#include <string.h>
+
+/* ----------------------------------------------------------------------
+   pack/unpack two 3-vectors, e.g. v and omega or f and torque, into a
+   double comm buffer
+   with MIXED_PRECISION_COMM_FLAG, they are sent as floats, two per
+     buffer slot, which halves the comm volume for these quantities
+   positions must always be sent in double precision
+   unpack_add accumulates in double precision
+------------------------------------------------------------------------- */
+
+namespace LAMMPS_NS {
+
+#ifdef MIXED_PRECISION_COMM_FLAG
+
+inline void pack_comm_vec6(double *buf, int &m,
+                           double a0, double a1, double a2,
+                           double b0, double b1, double b2)
+{
+  const float tmp[6] = {static_cast<float>(a0),static_cast<float>(a1),
+                        static_cast<float>(a2),static_cast<float>(b0),
+                        static_cast<float>(b1),static_cast<float>(b2)};
+  memcpy(&buf[m],tmp,6*sizeof(float));
+  m += 3;
+}
+
+inline void unpack_comm_vec6(const double *buf, int &m, double *a, double *b)
+{
+  float tmp[6];
+  memcpy(tmp,&buf[m],6*sizeof(float));
+  m += 3;
+  a[0] = tmp[0]; a[1] = tmp[1]; a[2] = tmp[2];
+  b[0] = tmp[3]; b[1] = tmp[4]; b[2] = tmp[5];
+}
+
+inline void unpack_add_comm_vec6(const double *buf, int &m, double *a, double *b)
+{
+  float tmp[6];
+  memcpy(tmp,&buf[m],6*sizeof(float));
+  m += 3;
+  a[0] += tmp[0]; a[1] += tmp[1]; a[2] += tmp[2];
+  b[0] += tmp[3]; b[1] += tmp[4]; b[2] += tmp[5];
+}
+
+#else
+
+inline void pack_comm_vec6(double *buf, int &m,
+                           double a0, double a1, double a2,
+                           double b0, double b1, double b2)
+{
+  buf[m++] = a0; buf[m++] = a1; buf[m++] = a2;
+  buf[m++] = b0; buf[m++] = b1; buf[m++] = b2;
+}
+
+inline void unpack_comm_vec6(const double *buf, int &m, double *a, double *b)
+{
+  a[0] = buf[m++]; a[1] = buf[m++]; a[2] = buf[m++];
+  b[0] = buf[m++]; b[1] = buf[m++]; b[2] = buf[m++];
+}
+
+inline void unpack_add_comm_vec6(const double *buf, int &m, double *a, double *b)
+{
+  a[0] += buf[m++]; a[1] += buf[m++]; a[2] += buf[m++];
+  b[0] += buf[m++]; b[1] += buf[m++]; b[2] += buf[m++];
+}
+
+#endif
+
+inline void pack_comm_vec6(double *buf, int &m, const double *a, const double *b)
+{
+  pack_comm_vec6(buf,m,a[0],a[1],a[2],b[0],b[1],b[2]);
+}
+
+}
+
+#endif
@@ -25,6 +25,7 @@
 #include "memory.h"
 #include "error.h"
 #include "force.h"
+#include "modify.h"
 
 using namespace LAMMPS_NS;
 
@@ -76,6 +77,8 @@ Compute::Compute(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp),
   invoked_scalar = invoked_vector = invoked_array = -1;
   invoked_peratom = invoked_local = -1;
 
+  recorded_time = 0.0;
+
   // set modify defaults
 
   extra_dof = domain->dimension;
@@ -149,6 +152,77 @@ void Compute::reset_extra_compute_fix(const char *)
              "Compute does not allow an extra compute or fix to be reset");
 }
 
+/* ----------------------------------------------------------------------
+   invoke compute_*() and add the time spent to recorded_time
+   if modify_timing is on
+------------------------------------------------------------------------- */
+
+double Compute::compute_scalar_timed()
+{
+  if (!modify->timing) return compute_scalar();
+
+  double time = MPI_Wtime();
+  double value = compute_scalar();
+  recorded_time += MPI_Wtime() - time;
+  return value;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Compute::compute_vector_timed()
+{
+  if (!modify->timing) {
+    compute_vector();
+    return;
+  }
+
+  double time = MPI_Wtime();
+  compute_vector();
+  recorded_time += MPI_Wtime() - time;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Compute::compute_array_timed()
+{
+  if (!modify->timing) {
+    compute_array();
+    return;
+  }
+
+  double time = MPI_Wtime();
+  compute_array();
+  recorded_time += MPI_Wtime() - time;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Compute::compute_peratom_timed()
+{
+  if (!modify->timing) {
+    compute_peratom();
+    return;
+  }
+
+  double time = MPI_Wtime();
+  compute_peratom();
+  recorded_time += MPI_Wtime() - time;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Compute::compute_local_timed()
+{
+  if (!modify->timing) {
+    compute_local();
+    return;
+  }
+
+  double time = MPI_Wtime();
+  compute_local();
+  recorded_time += MPI_Wtime() - time;
+}
+
 /* ----------------------------------------------------------------------
    add ntimestep to list of timesteps the compute will be called on
    do not add if already in list
@@ -105,6 +105,23 @@ class Compute : protected Pointers {
   virtual void compute_peratom() {}
   virtual void compute_local() {}
 
+  // same as compute_*(), but record the time spent if modify->timing is set
+  // used by thermo, variables, dumps and fix ave/*
+
+  double compute_scalar_timed();
+  void compute_vector_timed();
+  void compute_array_timed();
+  void compute_peratom_timed();
+  void compute_local_timed();
+
+  inline void reset_time_recording() {
+    recorded_time = 0.0;
+  }
+
+  inline double get_recorded_time() const {
+    return recorded_time;
+  }
+
   virtual int pack_comm(int, int *, double *, int, int *) {return 0;}
   virtual void unpack_comm(int, int, double *) {}
   virtual int pack_reverse_comm(int, int, double *) {return 0;}
@@ -142,6 +159,9 @@ class Compute : protected Pointers {
   inline int sbmask(int j) const {
     return j >> SBBITS & 3;
   }
+
+ private:
+  double recorded_time;        // time spent in compute_*_timed()
 };
 
 }
@@ -368,7 +368,7 @@ int DumpCustomVTK::count()
   if (ncompute) {
     for (i = 0; i < ncompute; i++)
       if (!(compute[i]->invoked_flag & INVOKED_PERATOM)) {
-        compute[i]->compute_peratom();
+        compute[i]->compute_peratom_timed();
         compute[i]->invoked_flag |= INVOKED_PERATOM;
       }
   }
@@ -27,6 +27,9 @@
 #include "math_const.h"
 #include "error.h"
 #include "memory.h"
+#include "modify.h"
+#include "fix_mesh_surface.h"
+#include "tri_mesh.h"
 
 using namespace LAMMPS_NS;
 using namespace MathConst;
@@ -120,6 +123,9 @@ DumpImage::DumpImage(LAMMPS *lmp, int narg, char **arg) :
   boxflag = YES;
   boxdiam = 0.02;
   axesflag = NO;
+  nmesh = 0;
+  meshfix = NULL;
+  meshcolor = NULL;
 
   // parse optional args
 
@@ -283,6 +289,25 @@ DumpImage::DumpImage(LAMMPS *lmp, int narg, char **arg) :
         error->all(FLERR,"Illegal dump image command");
       iarg += 4;
 
+    } else if (strcmp(arg[iarg],"mesh") == 0) {
+      if (iarg+3 > narg) error->all(FLERR,"Illegal dump image command");
+      int ifix = modify->find_fix(arg[iarg+1]);
+      if (ifix < 0 || strncmp(modify->fix[ifix]->style,"mesh/surface",12))
+        error->all(FLERR,"Dump image mesh ID must be a fix mesh/surface");
+      double *color = image->color2rgb(arg[iarg+2]);
+      if (color == NULL) error->all(FLERR,"Invalid color in dump image mesh");
+      meshfix = (FixMeshSurface **)
+        memory->srealloc(meshfix,(nmesh+1)*sizeof(FixMeshSurface *),
+                         "dump:meshfix");
+      meshcolor = (double **)
+        memory->srealloc(meshcolor,(nmesh+1)*sizeof(double *),
+                         "dump:meshcolor");
+      meshfix[nmesh] = static_cast<FixMeshSurface *>(modify->fix[ifix]);
+      meshfix[nmesh]->dumpAdd();
+      meshcolor[nmesh] = color;
+      nmesh++;
+      iarg += 3;
+
     } else if (strcmp(arg[iarg],"shiny") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal dump image command");
       double shiny = force->numeric(FLERR,arg[iarg+1]);
@@ -384,6 +409,10 @@ DumpImage::~DumpImage()
   delete [] bcolortype;
   memory->destroy(chooseghost);
   memory->destroy(bufcopy);
+
+  for (int i = 0; i < nmesh; i++) meshfix[i]->dumpRemove();
+  memory->sfree(meshfix);
+  memory->sfree(meshcolor);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -803,6 +832,20 @@ void DumpImage::create_image()
     }
   }
 
+  // render my triangles of each mesh
+  // each triangle is owned by one proc, so it is drawn once
+
+  for (int imesh = 0; imesh < nmesh; imesh++) {
+    TriMesh *mesh = meshfix[imesh]->triMesh();
+    int nlocal = mesh->sizeLocal();
+    double node[3][3];
+
+    for (i = 0; i < nlocal; i++) {
+      for (j = 0; j < 3; j++) mesh->node(i,j,node[j]);
+      image->draw_triangle(node[0],node[1],node[2],meshcolor[imesh]);
+    }
+  }
+
   // render outline of simulation box, orthogonal or triclinic
 
   if (boxflag) {
@@ -55,6 +55,10 @@ class DumpImage : public DumpCustom {
   int boxflag,axesflag;            // 0/1 for draw box and axes
   double boxdiam,axeslen,axesdiam; // params for drawing box and axes
 
+  int nmesh;                       // # of mesh/surface fixes to draw
+  class FixMeshSurface **meshfix;  // mesh/surface fixes to draw
+  double **meshcolor;              // color of each mesh
+
   int viewflag;                    // overall view is static or dynamic
 
   double *diamtype,*diamelement,*bdiamtype;         // per-type diameters
@@ -234,7 +234,7 @@ int DumpLocal::count()
   if (ncompute) {
     for (i = 0; i < ncompute; i++) {
       if (!(compute[i]->invoked_flag & INVOKED_LOCAL)) {
-        compute[i]->compute_local();
+        compute[i]->compute_local_timed();
         compute[i]->invoked_flag |= INVOKED_LOCAL;
       }
     }
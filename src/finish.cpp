@@ -31,9 +31,17 @@
 #include "memory.h"
 #include "modify.h"
 #include "fix.h"
+#include "compute.h"
 
 using namespace LAMMPS_NS;
 
+// names of the fix callbacks in the per-fix timing breakdown, see FixTime
+
+static const char *fix_time_names[FIX_TIME_N] =
+  {"initial_integrate","post_integrate","pre_exchange","pre_neighbor",
+   "pre_force","post_force","final_integrate","end_of_step",
+   "thermo_energy","other"};
+
 /* ---------------------------------------------------------------------- */
 
 Finish::Finish(LAMMPS *lmp) : Pointers(lmp) {}
@@ -644,8 +652,57 @@ void Finish::end(int flag)
              }
           }
         }
+
+        // min/avg/max over procs of each callback of this fix
+
+        double fix_min[FIX_TIME_N],fix_ave[FIX_TIME_N];
+        double fix_max[FIX_TIME_N],fix_sum[FIX_TIME_N];
+        for (int m = 0; m < FIX_TIME_N; m++)
+          fix_ave[m] = fix->get_recorded_time(m);
+        MPI_Allreduce(fix_ave,fix_min,FIX_TIME_N,MPI_DOUBLE,MPI_MIN,world);
+        MPI_Allreduce(fix_ave,fix_max,FIX_TIME_N,MPI_DOUBLE,MPI_MAX,world);
+        MPI_Allreduce(fix_ave,fix_sum,FIX_TIME_N,MPI_DOUBLE,MPI_SUM,world);
+
+        for (int m = 0; m < FIX_TIME_N; m++) {
+          if (fix_max[m] == 0.0) continue;
+          fix_ave[m] = fix_sum[m]/nprocs;
+          if (me == 0) {
+            if (screen)
+              fprintf(screen,"  %-16s min/avg/max = %g %g %g (%g)\n",
+                      fix_time_names[m],fix_min[m],fix_ave[m],fix_max[m],
+                      fix_ave[m]/time_loop*100.0);
+            if (logfile)
+              fprintf(logfile,"  %-16s min/avg/max = %g %g %g (%g)\n",
+                      fix_time_names[m],fix_min[m],fix_ave[m],fix_max[m],
+                      fix_ave[m]/time_loop*100.0);
+          }
+        }
       }
       delete [] fix_times;
+
+      // output compute timings
+      // included in Output time or in the time of the fix that invoked them
+
+      for(int i = 0; i < modify->ncompute; i++) {
+        Compute * compute = modify->compute[i];
+        time = compute->get_recorded_time();
+        MPI_Allreduce(&time,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
+        MPI_Allreduce(&time,&min,1,MPI_DOUBLE,MPI_MIN,world);
+        MPI_Allreduce(&time,&max,1,MPI_DOUBLE,MPI_MAX,world);
+        if (max == 0.0) continue;
+        time = tmp/nprocs;
+
+        if (me == 0) {
+          if (screen)
+            fprintf(screen,"Compute %s %s time (%%) = %g (%g)\n"
+                    "  min/avg/max = %g %g %g\n",compute->id,compute->style,
+                    time,time/time_loop*100.0,min,time,max);
+          if (logfile)
+            fprintf(logfile,"Compute %s %s time (%%) = %g (%g)\n"
+                    "  min/avg/max = %g %g %g\n",compute->id,compute->style,
+                    time,time/time_loop*100.0,min,time,max);
+        }
+      }
     }
   }
 
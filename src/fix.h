@@ -28,6 +28,13 @@
 
 namespace LAMMPS_NS {
 
+// callbacks for which the time is recorded separately if modify->timing is set
+
+enum FixTime{FIX_TIME_INITIAL_INTEGRATE,FIX_TIME_POST_INTEGRATE,
+             FIX_TIME_PRE_EXCHANGE,FIX_TIME_PRE_NEIGHBOR,FIX_TIME_PRE_FORCE,
+             FIX_TIME_POST_FORCE,FIX_TIME_FINAL_INTEGRATE,FIX_TIME_END_OF_STEP,
+             FIX_TIME_THERMO_ENERGY,FIX_TIME_OTHER,FIX_TIME_N};
+
 class Fix : protected Pointers {
  public:
   char *id,*style;
@@ -144,6 +151,7 @@ class Fix : protected Pointers {
   virtual int unpack_border(int, int, double *) {return 0;}
   virtual int pack_exchange(int, double *) {return 0;}
   virtual int unpack_exchange(int, double *) {return 0;}
+  virtual int exchange_field(double *&) {return 0;} // contiguous data/atom
   virtual int pack_restart(int, double *) {return 0;}
   virtual void unpack_restart(int, int) {}
   virtual int size_restart(int) {return 0;}
@@ -230,25 +238,33 @@ class Fix : protected Pointers {
 
  private:
   // add timing functionality to all fixes
+  // recorded_times holds the time spent in each callback, see FixTime
   double recorded_time;
+  double recorded_times[FIX_TIME_N];
   double previous_time;
 
  public:
   inline void reset_time_recording() {
     recorded_time = 0.0;
+    for (int i = 0; i < FIX_TIME_N; i++) recorded_times[i] = 0.0;
   }
 
   inline double get_recorded_time() const {
     return recorded_time;
   }
 
+  inline double get_recorded_time(int which) const {
+    return recorded_times[which];
+  }
+
   inline void begin_time_recording() {
     previous_time = MPI_Wtime();
   }
 
-  inline void end_time_recording() {
+  inline void end_time_recording(int which = FIX_TIME_OTHER) {
     double delta_time = MPI_Wtime() - previous_time;
     recorded_time += delta_time;
+    recorded_times[which] += delta_time;
   }
 
   union ubuf {  //NP modified R.B.
@@ -321,7 +321,7 @@ void FixAveAtom::end_of_step()
     } else if (which[m] == COMPUTE) {
       Compute *compute = modify->compute[n];
       if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-        compute->compute_peratom();
+        compute->compute_peratom_timed();
         compute->invoked_flag |= INVOKED_PERATOM;
       }
 
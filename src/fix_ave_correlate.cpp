@@ -410,13 +410,13 @@ void FixAveCorrelate::end_of_step()
 
       if (argindex[i] == 0) {
         if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-          compute->compute_scalar();
+          compute->compute_scalar_timed();
           compute->invoked_flag |= INVOKED_SCALAR;
         }
         scalar = compute->scalar;
       } else {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->compute_vector_timed();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         scalar = compute->vector[argindex[i]-1];
@@ -382,7 +382,7 @@ void FixAveEulerRegion::calculate_eu()
   //NP will only add a new step to those computes which were
   //NP invoked this time-step
   if (!(compute_stress_->invoked_flag & INVOKED_PERATOM)) {
-    compute_stress_->compute_peratom();
+    compute_stress_->compute_peratom_timed();
     compute_stress_->invoked_flag |= INVOKED_PERATOM;
   }
 
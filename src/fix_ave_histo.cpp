@@ -625,13 +625,13 @@ void FixAveHisto::end_of_step()
       if (kind == GLOBAL && mode == SCALAR) {
         if (j == 0) {
           if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-            compute->compute_scalar();
+            compute->compute_scalar_timed();
             compute->invoked_flag |= INVOKED_SCALAR;
           }
           bin_one(compute->scalar);
         } else {
           if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-            compute->compute_vector();
+            compute->compute_vector_timed();
             compute->invoked_flag |= INVOKED_VECTOR;
           }
           bin_one(compute->vector[j-1]);
@@ -639,13 +639,13 @@ void FixAveHisto::end_of_step()
       } else if (kind == GLOBAL && mode == VECTOR) {
         if (j == 0) {
           if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-            compute->compute_vector();
+            compute->compute_vector_timed();
             compute->invoked_flag |= INVOKED_VECTOR;
           }
           bin_vector(compute->size_vector,compute->vector,1);
         } else {
           if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-            compute->compute_array();
+            compute->compute_array_timed();
             compute->invoked_flag |= INVOKED_ARRAY;
           }
           if (compute->array)
@@ -655,7 +655,7 @@ void FixAveHisto::end_of_step()
 
       } else if (kind == PERATOM) {
         if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-          compute->compute_peratom();
+          compute->compute_peratom_timed();
           compute->invoked_flag |= INVOKED_PERATOM;
         }
         if (j == 0)
@@ -665,7 +665,7 @@ void FixAveHisto::end_of_step()
 
       } else if (kind == LOCAL) {
         if (!(compute->invoked_flag & INVOKED_LOCAL)) {
-          compute->compute_local();
+          compute->compute_local_timed();
           compute->invoked_flag |= INVOKED_LOCAL;
         }
         if (j == 0)
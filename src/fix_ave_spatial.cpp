@@ -644,7 +644,7 @@ void FixAveSpatial::end_of_step()
     } else if (which[m] == COMPUTE) {
       Compute *compute = modify->compute[n];
       if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-        compute->compute_peratom();
+        compute->compute_peratom_timed();
         compute->invoked_flag |= INVOKED_PERATOM;
       }
       double *vector = compute->vector_atom;
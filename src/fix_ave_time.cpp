@@ -541,13 +541,13 @@ void FixAveTime::invoke_scalar(bigint ntimestep)
 
       if (argindex[i] == 0) {
         if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-          compute->compute_scalar();
+          compute->compute_scalar_timed();
           compute->invoked_flag |= INVOKED_SCALAR;
         }
         scalar = compute->scalar;
       } else {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->compute_vector_timed();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         scalar = compute->vector[argindex[i]-1];
@@ -667,7 +667,7 @@ void FixAveTime::invoke_vector(bigint ntimestep)
 
       if (argindex[j] == 0) {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->compute_vector_timed();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         double *cvector = compute->vector;
@@ -676,7 +676,7 @@ void FixAveTime::invoke_vector(bigint ntimestep)
 
       } else {
         if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-          compute->compute_array();
+          compute->compute_array_timed();
           compute->invoked_flag |= INVOKED_ARRAY;
         }
         double **carray = compute->array;
@@ -34,6 +34,7 @@
 #include "kspace.h"
 #include "error.h"
 #include "modify.h" //NP modified C.K.
+#include "fix_insert.h"
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -80,6 +81,9 @@ FixBalance::FixBalance(LAMMPS *lmp, int narg, char **arg) :
 
   int outarg = 0;
   fp = NULL;
+  predict_flag = 0;
+  nfix_insert = 0;
+  fix_insert = NULL;
 
   int iarg = 7;
   while (iarg < narg) {
@@ -87,6 +91,12 @@ FixBalance::FixBalance(LAMMPS *lmp, int narg, char **arg) :
       if (iarg+2 > narg) error->all(FLERR,"Illegal fix balance command");
       outarg = iarg+1;
       iarg += 2;
+    } else if (strcmp(arg[iarg],"predict_insertion") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix balance command");
+      if (strcmp(arg[iarg+1],"yes") == 0) predict_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) predict_flag = 0;
+      else error->all(FLERR,"Illegal fix balance command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal fix balance command");
   }
 
@@ -132,6 +142,7 @@ FixBalance::~FixBalance()
   if (fp) fclose(fp);
   delete balance;
   delete irregular;
+  delete [] fix_insert;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -162,6 +173,12 @@ void FixBalance::init()
   int ntypes = atom->ntypes;
   for(int ifix = 0; ifix < nfix; ifix++)
   {
+      if(my_i < ifix && strncmp(fix[ifix]->style,"insert/",7) == 0)
+      {
+          char errstr[200];
+          sprintf(errstr,"Fix %s has to come before fix %s",fix[ifix]->style,style);
+          error->fix_error(FLERR,this,errstr);
+      }
       for(int itype = 0; itype < ntypes+1; itype++)
       {
           if(my_i < ifix && fix[ifix]->max_rad(itype) > 0.)
@@ -172,6 +189,24 @@ void FixBalance::init()
           }
       }
   }
+
+  // insertion fixes used for predicting particle counts
+
+  delete [] fix_insert;
+  fix_insert = NULL;
+  nfix_insert = 0;
+
+  if (predict_flag)
+  {
+      fix_insert = new FixInsert*[nfix];
+      for(int ifix = 0; ifix < nfix; ifix++)
+      {
+          FixInsert *fix_ins = dynamic_cast<FixInsert*>(fix[ifix]);
+          if(fix_ins) fix_insert[nfix_insert++] = fix_ins;
+      }
+      if(nfix_insert == 0 && comm->me == 0)
+        error->warning(FLERR,"Fix balance predict_insertion yes is used, but no fix insert was found");
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -198,8 +233,10 @@ void FixBalance::setup_pre_exchange()
 
   // perform a rebalance if threshhold exceeded
 
+  if (predict_flag) predict_insertion();
   imbnow = balance->imbalance_nlocal(maxperproc);
   if (imbnow > thresh) rebalance();
+  balance->clear_prediction();
 
   // next_reneighbor = next time to force reneighboring
 
@@ -213,8 +250,9 @@ void FixBalance::setup_pre_exchange()
 void FixBalance::pre_exchange()
 {
   // return if not a rebalance timestep
+  // if insertions are predicted, also rebalance on each insertion step
 
-  if (nevery && update->ntimestep < next_reneighbor) return;
+  if (nevery && update->ntimestep < next_reneighbor && !inserted_this_step()) return;
 
   // insure atoms are in current box & update box via shrink-wrap
   // no exchange() since doesn't matter if atoms are assigned to correct procs
@@ -225,14 +263,19 @@ void FixBalance::pre_exchange()
   if (domain->triclinic) domain->lamda2x(atom->nlocal);
 
   // return if imbalance < threshhold
+  // account for particles to be inserted before next rebalance
+
+  if (predict_flag) predict_insertion();
 
   imbnow = balance->imbalance_nlocal(maxperproc);
   if (imbnow <= thresh) {
+    balance->clear_prediction();
     if (nevery) next_reneighbor = (update->ntimestep/nevery)*nevery + nevery;
     return;
   }
 
   rebalance();
+  balance->clear_prediction();
 
   // next timestep to rebalance
 
@@ -300,6 +343,39 @@ void FixBalance::rebalance()
   pending = 1;
 }
 
+/* ----------------------------------------------------------------------
+   true if any of the insertion fixes inserted particles on this step
+   insertion fixes come before this fix, so have already been invoked
+------------------------------------------------------------------------- */
+
+bool FixBalance::inserted_this_step()
+{
+  for (int i = 0; i < nfix_insert; i++)
+    if (fix_insert[i]->inserted_this_step()) return true;
+  return false;
+}
+
+/* ----------------------------------------------------------------------
+   register particles that will be inserted until next rebalance
+   nevery = 0 means rebalance on every insertion, so predict next one
+------------------------------------------------------------------------- */
+
+void FixBalance::predict_insertion()
+{
+  double lo[3],hi[3];
+  bigint ntimestep = update->ntimestep;
+
+  for (int i = 0; i < nfix_insert; i++) {
+    if (!fix_insert[i]->insertion_volume(lo,hi)) continue;
+
+    bigint horizon = nevery;
+    if (horizon == 0) horizon = fix_insert[i]->ins_every();
+    if (horizon < 1) horizon = 1;
+
+    balance->add_prediction(lo,hi,fix_insert[i]->predict_ninsert(ntimestep+horizon));
+  }
+}
+
 /* ----------------------------------------------------------------------
    return imbalance factor after last rebalance
 ------------------------------------------------------------------------- */
@@ -63,10 +63,16 @@ class FixBalance : public Fix {
   int kspace_flag;              // 1 if KSpace solver defined
   int pending;
 
+  int predict_flag;             // 1 if insertions are taken into account
+  int nfix_insert;
+  class FixInsert **fix_insert;
+
   class Balance *balance;
   class Irregular *irregular;
 
   void rebalance();
+  bool inserted_this_step();
+  void predict_insertion();
 };
 
 }
@@ -94,4 +100,8 @@ E: Cannot open fix balance output file
 
 Self-explanatory.
 
+W: Fix balance predict_insertion yes is used, but no fix insert was found
+
+Only particle insertions by fix insert commands are predicted.
+
 */
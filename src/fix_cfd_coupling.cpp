@@ -35,6 +35,7 @@
 #include "fix_multisphere.h"
 #include "fix_property_global.h"
 #include "fix_property_atom.h"
+#include "trace.h"
 #include "fix_cfd_coupling.h"
 #include "style_cfd_datacoupling.h"
 #include "cfd_regionmodel.h"
@@ -197,7 +198,10 @@ void FixCfdCoupling::end_of_step()
     if(rm_) rm_->rm_update();
 
     // call data exchange model to exchane data
-    dc_->exchange();
+    {
+      TRACE_REGION("FixCfdCoupling::exchange");
+      dc_->exchange();
+    }
 
     // check if datatransfer was successful
     // dc_->check_datatransfer();
@@ -211,11 +211,9 @@ void FixCfdCouplingConvection::post_force(int)
   
   if(0 == neighbor->ago)
   {
-      fix_convectiveFlux->do_forward_comm();
-      if (gran_field_conduction)
-      {
-          fix_conductiveFlux->do_forward_comm();
-      }
+      //NP both fluxes in one message
+      FixPropertyAtom *fixes[2] = { fix_convectiveFlux, fix_conductiveFlux };
+      FixPropertyAtom::do_forward_comm(gran_field_conduction ? 2 : 1,fixes);
   }
 
   double *heatFlux = fix_heatFlux->vector_atom;
@@ -37,6 +37,7 @@
 #include "fix_property_global.h"
 #include "fix_property_atom_polydispparcel.h"
 #include "force.h"
+#include "comm.h"
 #include "group.h"
 #include "math_const.h"
 
@@ -111,6 +112,12 @@ const double FixChemShrinkCore::Ea_low_H2[] = { 75000., 75000., 75000. };
 const double FixChemShrinkCore::layerMolMasses_[] = { 0.055845, 0.071844, 0.231532, 0.1596882 };
 #endif
 
+enum {
+    REDUCTANT_UNDEFINED = 0,
+    REDUCTANT_CO,
+    REDUCTANT_H2
+};
+
 enum {
     LAYER_WUSTITE = 0,
     LAYER_MAGNETITE,
@@ -122,7 +129,7 @@ enum {
 
 FixChemShrinkCore::FixChemShrinkCore(LAMMPS *lmp, int narg, char **arg) :
     Fix(lmp, narg, arg),
-    layers_(MAX_LAYERS),
+    reductant_(REDUCTANT_UNDEFINED),
     minMolarFrac_(1e-3),
     rmin_(1e-5),      //  [m]
     created_fix_layerMass_(false),
@@ -221,6 +228,14 @@ FixChemShrinkCore::FixChemShrinkCore(LAMMPS *lmp, int narg, char **arg) :
         }
     }
 
+    // resolve reducing agent once, it selects the rate laws
+    if (strcmp(speciesA, "CO") == 0)
+        reductant_ = REDUCTANT_CO;
+    else if (strcmp(speciesA, "H2") == 0)
+        reductant_ = REDUCTANT_H2;
+    else
+        reductant_ = REDUCTANT_UNDEFINED;
+
     // define changed species mass A
     massA = new char [strlen("Modified_")+strlen(speciesA)+1];
     strcpy(massA,"Modified_");
@@ -687,9 +702,9 @@ void FixChemShrinkCore::setup(int)
     {
         if (mask[i] & groupbit)
         {
-            active_layers(i);
+            const int layers = active_layers(i);
 
-            for (int layer=0; layer <= layers_; layer++)
+            for (int layer=0; layer <= layers; layer++)
             {
 #ifdef PER_ATOM_LAYER_DENSITIES
                 rhoeff_[i][layer] = (1.0 - porosity_[layer])*layerDensities_[i][layer];
@@ -697,7 +712,7 @@ void FixChemShrinkCore::setup(int)
                 rhoeff_[i][layer] = (1.0 - porosity_[layer])*layerDensities_[layer];
 #endif
             }
-            calcMassLayer(i);
+            calcMassLayer(i,layers);
         }
     }
 }
@@ -717,14 +732,21 @@ void FixChemShrinkCore::post_force(int)
         return;
 
     updatePtrs();
-    int i = 0;
-    int nlocal  =   atom->nlocal;
-    int *mask   =   atom->mask;
-    double x0_eq_[MAX_LAYERS] = {0.}; // molar fraction of reactant gas
-    double dmA_[MAX_LAYERS] = {0.};   // mass flow rate of reactant gas species for each layer at w->fe, m->w & h->m interfaces
+    const int nlocal  =   atom->nlocal;
+    const int *mask   =   atom->mask;
 
-    for (i = 0; i < nlocal; i++)
+    // particles are independent, each one only updates its own properties
+    // the # of active layers is passed to the kernels, so it is per thread
+
+#if defined(_OPENMP)
+    #pragma omp parallel for schedule(dynamic,64) default(shared) num_threads(comm->nthreads)
+#endif
+    for (int i = 0; i < nlocal; i++)
     {
+        double x0_eq_[MAX_LAYERS] = {0.}; // molar fraction of reactant gas
+        double dmA_[MAX_LAYERS] = {0.};   // mass flow rate of reactant gas species for each layer at w->fe, m->w & h->m interfaces
+        double Keq_[MAX_LAYERS] = {0.};   // equilibrium constant of each layer, evaluated once per particle
+
         if (mask[i] & groupbit)
         {
             if (xA_[i] < minMolarFrac_)
@@ -734,7 +756,8 @@ void FixChemShrinkCore::post_force(int)
 
             // 1st recalculate masses of layers if layer has reduced
             // is ignored if there is no change in layers
-            if (active_layers(i) > 0)
+            const int layers = active_layers(i);
+            if (layers > 0)
             {
                 if (T_[i] < 573.15) // Kelvin / 300 Celsius
                 {
@@ -748,20 +771,20 @@ void FixChemShrinkCore::post_force(int)
 #else
 #ifdef PSEUDO_THREE_LAYERS
                     // treating wustite layer as if it were Fe, thus no more reaction at this point
-                    if (layers_ <= 1)
+                    if (layers <= 1)
                         continue;
 #endif
 
                     FractionalReduction(i);
 #endif
-                    getXi_low(i,x0_eq_);
-                    getA_low(i);
-                    getB(i);
+                    getXi_low(i,layers,x0_eq_,Keq_);
+                    getA_low(i,layers,Keq_);
+                    getB(i,layers);
                     getMassT(i);
-                    reaction_low(i, dmA_, x0_eq_);
-                    update_atom_properties(i, dmA_,v_reac_low_,v_prod_low_);
+                    reaction_low(i,layers, dmA_, x0_eq_);
+                    update_atom_properties(i,layers, dmA_,v_reac_low_,v_prod_low_);
                     update_gas_properties(i, dmA_);
-                    heat_of_reaction(i, dmA_,v_reac_low_,v_prod_low_);
+                    heat_of_reaction(i,layers, dmA_,v_reac_low_,v_prod_low_);
                 }
                 else // T_[i] > 843.15 K
                 {
@@ -771,26 +794,26 @@ void FixChemShrinkCore::post_force(int)
                     // get values for equilibrium molar fraction of reactant gas species,
                     // this value is calculated from the Equilibrium constants function Keq(layer,T).
                     // and used in the reaction rate determination.
-                    getXi(i,x0_eq_);
+                    getXi(i,layers,x0_eq_,Keq_);
                     // calculate the reaction resistance term
-                    getA(i);
+                    getA(i,layers,Keq_);
                     // calculate the diffusion resistance term
-                    getB(i);
+                    getB(i,layers);
                     // calculate mass transfer resistance term
                     getMassT(i);
                     // do the reaction calculation with pre-calculated values of A, B and ß (massT)
                     // the USCM model chemical reaction rate with gaseous species model
                     // based on the works of Philbrook, Spitzer and Manning
-                    reaction(i, dmA_, x0_eq_);
+                    reaction(i,layers, dmA_, x0_eq_);
                     // the results of reaction gives us the mass change of reactant species gas
                     // in the usual case that means the CO gas mass species change is given
                     // this information is used then to calculate mass changes of particle layers
-                    update_atom_properties(i, dmA_,v_reac_,v_prod_);
+                    update_atom_properties(i,layers, dmA_,v_reac_,v_prod_);
                     // also the results of reaction function is used to calculate
                     // the changes in gas species
                     update_gas_properties(i, dmA_);
                     // calculate delta_h, and dot_delta_h for heat of reaction
-                    heat_of_reaction(i, dmA_,v_reac_,v_prod_);
+                    heat_of_reaction(i,layers, dmA_,v_reac_,v_prod_);
                 }
             }
         }
@@ -801,33 +824,33 @@ void FixChemShrinkCore::post_force(int)
 
 int FixChemShrinkCore::active_layers(int i)
 {
-    layers_ = MAX_LAYERS;
+    int layers = MAX_LAYERS;
 
-    for (int j = layers_; j > 0; j--)
+    for (int j = layers; j > 0; j--)
     {
         if (relRadii_[i][j]*(radius_[i]/cg_) < rmin_)
         {
-            --layers_;
+            --layers;
         }
     }
 
     if (screenflag_ && screen)
-        fprintf(screen, "active layers: %i \n", layers_);
-    return layers_;
+        fprintf(screen, "active layers: %i \n", layers);
+    return layers;
 }
 
 /* ---------------------------------------------------------------------- */
 
 // 0 = iron shell, 1 = wüstite layer, 2 = magnetite layer, 3 = hematite layer
-void FixChemShrinkCore::calcMassLayer(int i)
+void FixChemShrinkCore::calcMassLayer(int i, int layers)
 {
     double rad[MAX_LAYERS+1] = {0.};
-    for (int layer = 0; layer <= layers_ ; layer++)
+    for (int layer = 0; layer <= layers ; layer++)
         rad[layer] = (radius_[i]/cg_)*relRadii_[i][layer];
 
-    massLayer_[i][layers_] = MY_4PI3*rhoeff_[i][layers_]*rad[layers_]*rad[layers_]*rad[layers_];
+    massLayer_[i][layers] = MY_4PI3*rhoeff_[i][layers]*rad[layers]*rad[layers]*rad[layers];
 
-    for (int layer = 0 ; layer < layers_; layer++)
+    for (int layer = 0 ; layer < layers; layer++)
     {
         massLayer_[i][layer] = MY_4PI3*rhoeff_[i][layer]*(rad[layer  ]*rad[layer  ]*rad[layer  ]
                                                          -rad[layer+1]*rad[layer+1]*rad[layer+1]);
@@ -835,7 +858,7 @@ void FixChemShrinkCore::calcMassLayer(int i)
 
     if (fix_polydisp_)
     {
-        for (int layer = 0 ; layer <= layers_; layer++)
+        for (int layer = 0 ; layer <= layers; layer++)
         {
             massLayer_[i][layer] *= effvolfactors_[i];
         }
@@ -851,7 +874,7 @@ double FixChemShrinkCore::K_eq(int layer, int i)
     // 2 = Fe2O3 (hematite)  -> Fe3O4 (magnetite)
     double Keq_ = 0.;
 
-    if (strcmp(speciesA, "CO") == 0)
+    if (reductant_ == REDUCTANT_CO)
     {
         if (layer == 2)
             Keq_ = exp(3968.37/T_[i]+3.94);        // Valipour 2009, Nietrost 2012
@@ -862,7 +885,7 @@ double FixChemShrinkCore::K_eq(int layer, int i)
             Keq_ = pow(10.0,(914.0/T_[i]-1.097));  // Nietrost 2012
             // Keq_ = exp(2744.63/T_[i]-2.946);    // Valipour 2009
      }
-     else if(strcmp(speciesA,"H2")==0)
+     else if (reductant_ == REDUCTANT_H2)
      {
         if (layer == 2)
             Keq_   =   exp(-362.6/T_[i] + 10.334); // Valipour 2009, Nietrost 2012
@@ -887,13 +910,14 @@ double FixChemShrinkCore::K_eq(int layer, int i)
 
 /* ---------------------------------------------------------------------- */
 
-void FixChemShrinkCore::getXi(int i, double *x0_eq_)
+void FixChemShrinkCore::getXi(int i, int layers, double *x0_eq_, double *Keq_)
 {
     const double kch2_ = xA_[i] + xC_[i];
 
-    for (int j = 0; j < layers_; j++)
+    for (int j = 0; j < layers; j++)
     {
-        x0_eq_[j]  =   kch2_/(1.0+K_eq(j,i));
+        Keq_[j]    =   K_eq(j,i);
+        x0_eq_[j]  =   kch2_/(1.0+Keq_[j]);
     }
 
     if (screenflag_ && screen)
@@ -905,13 +929,16 @@ void FixChemShrinkCore::getXi(int i, double *x0_eq_)
 // calculate A_[j] [s/m] - the chemical reaction resistance term
 // Equation available in literature. (Valipour, Natsui, Nietrost...)
 // 0 = wüstite interface, 1 = magnetite interface, 2 = hematite interface
-void FixChemShrinkCore::getA(int i)
+// Keq_ are the equilibrium constants from getXi()
+void FixChemShrinkCore::getA(int i, int layers, const double *Keq_)
 {
-    for (int j = 0; j < layers_ ; j++)
+    const double invRT = 1.0 / (Runiv*T_[i]);
+
+    for (int j = 0; j < layers ; j++)
     {
-            Aterm[i][j] = (k0_[j] * exp(-Ea_[j] / (Runiv*T_[i])))
+            Aterm[i][j] = (k0_[j] * exp(-Ea_[j] * invRT))
                         * cbrt((1.0 - fracRed_[i][j]) * (1.0 - fracRed_[i][j]))
-                        * (1.0 + 1.0 / K_eq(j,i));
+                        * (1.0 + 1.0 / Keq_[j]);
             Aterm[i][j] = 1.0 / Aterm[i][j];
     }
 }
@@ -922,12 +949,12 @@ void FixChemShrinkCore::getA(int i)
 // Use binary diffusion for mixture, and knudsen diffusion to determine the effective diffusion term
 // 0 : diffusion through iron layer, 1 : diffusion through wüstite, 2 : diffusion through magnetite.
 // there is no diffusion through the hematite layer
-void FixChemShrinkCore::getB(int i)
+void FixChemShrinkCore::getB(int i, int layers)
 {
     double fracRedThird_[MAX_LAYERS] = {0.};
     double diffEff_[MAX_LAYERS] = {0.};
 
-    for (int layer = 0; layer < layers_; layer++)
+    for (int layer = 0; layer < layers; layer++)
     {
         // calculate fractional reduction to the power of 1/3 for simpler use
         fracRedThird_[layer] = cbrt(1.0-fracRed_[i][layer]);
@@ -964,14 +991,14 @@ void FixChemShrinkCore::getB(int i)
     // calculation of diffusion term
     if (molecularDiffusion_[i] < SMALL)
     {
-        for (int layer = 0; layer < layers_; layer++)
+        for (int layer = 0; layer < layers; layer++)
             Bterm[i][layer] = 0.0;
     }
     else
     {
         // diffusion resistance through Fe
         Bterm[i][0]   =   ((1-fracRedThird_[0])/fracRedThird_[0])*((radius_[i]/cg_)/(diffEff_[0]));
-        for (int layer = 1; layer < layers_; layer++)
+        for (int layer = 1; layer < layers; layer++)
         {
             Bterm[i][layer] = (fracRedThird_[layer-1]-fracRedThird_[layer])/(fracRedThird_[layer-1]*fracRedThird_[layer])*((radius_[i]/cg_)/(diffEff_[layer]));
         }
@@ -981,7 +1008,7 @@ void FixChemShrinkCore::getB(int i)
     if (T_[i] < SWITCH_LOW_HIGH_TEMPERATURE) {
 #ifdef PSEUDO_THREE_LAYERS
         Bterm[i][0] = 1.0; // not used, set to something that does not disturb plotting of Bterms
-        if (layers_ > 1)
+        if (layers > 1)
             Bterm[i][1] = ((1-fracRedThird_[1])/fracRedThird_[1])*((radius_[i]/cg_)/(diffEff_[0]));
 #else
 
@@ -1022,7 +1049,7 @@ void FixChemShrinkCore::getMassT(int i)
 
 /* ---------------------------------------------------------------------- */
 
-void FixChemShrinkCore::reaction(int i, double *dmA_, const double *x0_eq_)
+void FixChemShrinkCore::reaction(int i, int layers, double *dmA_, const double *x0_eq_)
 {
 
 #ifdef TWO_LAYERS
@@ -1031,7 +1058,7 @@ void FixChemShrinkCore::reaction(int i, double *dmA_, const double *x0_eq_)
 
     double p_eq_[MAX_LAYERS] = {0.};
 
-    for (int layer = 0; layer < layers_; layer++)
+    for (int layer = 0; layer < layers; layer++)
     {
         p_eq_[layer] = x0_eq_[layer] * partP_[i];
     }
@@ -1043,7 +1070,7 @@ void FixChemShrinkCore::reaction(int i, double *dmA_, const double *x0_eq_)
         fprintf(screen, "p_eq_I: %f, p_eq_II: %f, p_eq_III: %f, p_A: %f \n", p_eq_[0], p_eq_[1],p_eq_[2],p_A);
     }
 
-    if (layers_ == 3)
+    if (layers == 3)
     {
         const double A0 = Aterm[i][0];
         const double A1 = Aterm[i][1];
@@ -1093,7 +1120,7 @@ void FixChemShrinkCore::reaction(int i, double *dmA_, const double *x0_eq_)
             dY[i][0] = 0.0;
 
     }
-    else if (layers_ == 2)
+    else if (layers == 2)
     {
         const double A0 = Aterm[i][0];
         const double A1plusB1         = Aterm[i][1] + Bterm[i][1];
@@ -1125,7 +1152,7 @@ void FixChemShrinkCore::reaction(int i, double *dmA_, const double *x0_eq_)
             dY[i][0] = 0.0;
 
     }
-    else if (layers_ == 1)
+    else if (layers == 1)
     {
         // rate of chemical reaction for 1 active layer
         const double W = Aterm[i][0] + Bterm[i][0] + Massterm[i];
@@ -1143,7 +1170,7 @@ void FixChemShrinkCore::reaction(int i, double *dmA_, const double *x0_eq_)
             dY[i][0] = 0.0;
     }
 
-    for (int j = 0 ; j < layers_; j++)
+    for (int j = 0 ; j < layers; j++)
     {
         // mass flow rate for reactant gas species
         // dmA is a positive value
@@ -1157,7 +1184,7 @@ void FixChemShrinkCore::reaction(int i, double *dmA_, const double *x0_eq_)
 
 /* ---------------------------------------------------------------------- */
 
-void FixChemShrinkCore::update_atom_properties(int i, const double *dmA_,const double *v_reac, const double* v_prod)
+void FixChemShrinkCore::update_atom_properties(int i, int layers, const double *dmA_,const double *v_reac, const double* v_prod)
 {
     if (screenflag_ && screen)
         fprintf(screen,"run update atom props \n");
@@ -1172,11 +1199,11 @@ void FixChemShrinkCore::update_atom_properties(int i, const double *dmA_,const d
     // Mass Change of Layers
     // dmL is a positive value, therefore it will be subtracted from the total mass
     // Fe2O3 (iniital)
-    dmL_[layers_] = dmA_[layers_-1] * v_reac[layers_-1] * (layerMolMasses_[layers_] / molMass_A_);
+    dmL_[layers] = dmA_[layers-1] * v_reac[layers-1] * (layerMolMasses_[layers] / molMass_A_);
 
     // Initial FeO & Fe3O4 layers
     // changes with active layers
-    for (int layer = 1; layer < layers_; layer++)
+    for (int layer = 1; layer < layers; layer++)
         dmL_[layer] = -dmA_[layer]   * v_prod[layer]   * (layerMolMasses_[layer] / molMass_A_)
                      + dmA_[layer-1] * v_reac[layer-1] * (layerMolMasses_[layer] / molMass_A_);
 
@@ -1186,7 +1213,7 @@ void FixChemShrinkCore::update_atom_properties(int i, const double *dmA_,const d
     // slow decay of 4FeO -> Fe + Fe3O4 at low temperatures could be incorporated at this point
 
     // New layer masses
-    for (int j = 0; j <= layers_; j++)
+    for (int j = 0; j <= layers; j++)
     {
         massLayer_[i][j] -= dmL_[j]*scale_reduction_rate;
         if (massLayer_[i][j] < 0.0)
@@ -1208,15 +1235,15 @@ void FixChemShrinkCore::update_atom_properties(int i, const double *dmA_,const d
     // if (screen) fprintf(screen, "pmass = %f \n",pmass_[i]);
 
     // Core layer radius (initial Fe2O3)
-    rad[layers_] = cbrt((0.75*massLayer_[i][layers_])/(rhoeff_[i][layers_]*M_PI));
+    rad[layers] = cbrt((0.75*massLayer_[i][layers])/(rhoeff_[i][layers]*M_PI));
 
     // Outer layer radii (Fe3O4, FeO)
-    for (int layer = layers_ - 1; layer > 0; layer--)
+    for (int layer = layers - 1; layer > 0; layer--)
         rad[layer]   =   cbrt((0.75*massLayer_[i][layer]/(rhoeff_[i][layer]*M_PI))+rad[layer+1]*rad[layer+1]*rad[layer+1]);
 
     if (fix_polydisp_)
     {
-        for (int layer = layers_; layer > 0; layer--)
+        for (int layer = layers; layer > 0; layer--)
         {
             rad[layer] /= cbrt(effvolfactors_[i]);
         }
@@ -1229,7 +1256,7 @@ void FixChemShrinkCore::update_atom_properties(int i, const double *dmA_,const d
     rad[0] = radius_[i]/cg_;
 
     // Determine new relative radii after reduction
-    for (int j = 1; j <= layers_; j++)
+    for (int j = 1; j <= layers; j++)
     {
         relRadii_[i][j] = rad[j]/rad[0];
     }
@@ -1303,7 +1330,7 @@ void FixChemShrinkCore::FractionalReduction(int i)
 /* ---------------------------------------------------------------------- */
 
 /* Heat of Reaction Calcualtion Depending on JANAF thermochemical tables */
-void FixChemShrinkCore::heat_of_reaction(int i, const double *dmA_, const double *v_reac, const double *v_prod)
+void FixChemShrinkCore::heat_of_reaction(int i, int layers, const double *dmA_, const double *v_reac, const double *v_prod)
 {
     double HR[MAX_LAYERS] = {0.};
     // reaction enthalpy
@@ -1325,12 +1352,12 @@ void FixChemShrinkCore::heat_of_reaction(int i, const double *dmA_, const double
 #endif
     }
 
-    if (strcmp(speciesA, "CO") == 0)
+    if (reductant_ == REDUCTANT_CO)
     {
         conv_h[4] = conv_enthalpy(a_coeff_nasa_CO,i);
         conv_h[5] = conv_enthalpy(a_coeff_nasa_CO2,i);
     }
-    else if (strcmp(speciesA,"H2")==0)
+    else if (reductant_ == REDUCTANT_H2)
     {
         conv_h[4] = conv_enthalpy(a_coeff_nasa_H2,i);
         conv_h[5] = conv_enthalpy(a_coeff_nasa_H2O,i);
@@ -1338,12 +1365,12 @@ void FixChemShrinkCore::heat_of_reaction(int i, const double *dmA_, const double
     conv_h54 = conv_h[5] - conv_h[4];
 
     // enthalpy changes due to iron oxides
-    for (int j = 0; j < layers_; j++)
+    for (int j = 0; j < layers; j++)
     {
         delta_h[j] = v_prod[j] * conv_h[j] - v_reac[j] * conv_h[j+1];
     }
     // enthalpy changes due to reduction agent
-    for (int j = 0; j < layers_; j++)
+    for (int j = 0; j < layers; j++)
     {
 #ifdef PSEUDO_THREE_LAYERS
         if (T_[i]<SWITCH_LOW_HIGH_TEMPERATURE && j == 1) continue;
@@ -1359,7 +1386,7 @@ void FixChemShrinkCore::heat_of_reaction(int i, const double *dmA_, const double
 #endif
     }
 
-    for (int k = 0; k < layers_; k++)
+    for (int k = 0; k < layers; k++)
     {
         HR[k] = delta_h[k]*dmA_[k]/molMass_A_*cg_*cg_*cg_;
     }
@@ -1373,7 +1400,7 @@ void FixChemShrinkCore::heat_of_reaction(int i, const double *dmA_, const double
     }
 
     // add per-particle reactionHeat flux
-    for (int k = 0; k < layers_; k++)
+    for (int k = 0; k < layers; k++)
         reactionHeat_[i] += HR[k];
 }
 
@@ -1443,7 +1470,7 @@ double FixChemShrinkCore::K_eq_low(int layer, int i)
 #ifdef TWO_LAYERS
     // 0 = Fe3O4 (magnetite) -> Fe (iron)
     // 1 = Fe2O3 (hematite)  -> Fe3O4 (magnetite)
-    if (strcmp(speciesA, "CO") == 0)
+    if (reductant_ == REDUCTANT_CO)
     {
         if (layer == 1) {
             Keq_low = exp(3968.37/T_[i]+3.94);
@@ -1451,7 +1478,7 @@ double FixChemShrinkCore::K_eq_low(int layer, int i)
             Keq_low = 0.97949;// =pow(10.0,-0.009);
         }
     }
-    else if(strcmp(speciesA,"H2")==0)
+    else if (reductant_ == REDUCTANT_H2)
     {
         if (layer == 1)
             Keq_low = exp(-362.6/T_[i] + 10.334);
@@ -1459,7 +1486,7 @@ double FixChemShrinkCore::K_eq_low(int layer, int i)
             Keq_low = pow(10.0,(-1742.0/T_[i]+1.568));
     }
 #else
-    if (strcmp(speciesA, "CO") == 0)
+    if (reductant_ == REDUCTANT_CO)
     {
         switch(layer) {
         case LAYER_HEMATITE:
@@ -1473,7 +1500,7 @@ double FixChemShrinkCore::K_eq_low(int layer, int i)
             break;
         }
     }
-    else if (strcmp(speciesA,"H2")==0)
+    else if (reductant_ == REDUCTANT_H2)
     {
         switch(layer) {
         case LAYER_HEMATITE:
@@ -1501,11 +1528,11 @@ double FixChemShrinkCore::K_eq_low(int layer, int i)
 
 /* ---------------------------------------------------------------------- */
 
-void FixChemShrinkCore::reaction_low(int i, double *dmA_, const double *x0_eq_)
+void FixChemShrinkCore::reaction_low(int i, int layers, double *dmA_, const double *x0_eq_)
 {
     double p_eq_[MAX_LAYERS] = {0.};
 
-    for (int layer = 0; layer < layers_; layer++)
+    for (int layer = 0; layer < layers; layer++)
     {
         p_eq_[layer] = x0_eq_[layer] * partP_[i];
     }
@@ -1518,7 +1545,7 @@ void FixChemShrinkCore::reaction_low(int i, double *dmA_, const double *x0_eq_)
     }
 
 #ifdef TWO_LAYERS
-    if (layers_ == 2)
+    if (layers == 2)
     {
         const double A0 = Aterm[i][0];
         const double A1plusB1         = Aterm[i][1] + Bterm[i][1];
@@ -1543,7 +1570,7 @@ void FixChemShrinkCore::reaction_low(int i, double *dmA_, const double *x0_eq_)
             dY[i][0] = 0.0;
 
     }
-    else if (layers_ == 1)
+    else if (layers == 1)
     {
         // rate of chemical reaction for 1 active layer
         const double W = Aterm[i][0] + Bterm[i][0] + Massterm[i];
@@ -1559,7 +1586,7 @@ void FixChemShrinkCore::reaction_low(int i, double *dmA_, const double *x0_eq_)
     }
 #else
 #ifdef PSEUDO_THREE_LAYERS
-    if (layers_ == 3)
+    if (layers == 3)
     {
         const double A0 = Aterm[i][1];
         const double A1plusB1         = Aterm[i][2] + Bterm[i][2];
@@ -1583,7 +1610,7 @@ void FixChemShrinkCore::reaction_low(int i, double *dmA_, const double *x0_eq_)
         if (dY[i][1] < 0.0)
             dY[i][1] = 0.0;
     }
-    else if (layers_ == 2)
+    else if (layers == 2)
     {
         // rate of chemical reaction for 1 active layer
         const double W = Aterm[i][1] + Bterm[i][1] + Massterm[i];
@@ -1597,7 +1624,7 @@ void FixChemShrinkCore::reaction_low(int i, double *dmA_, const double *x0_eq_)
         if (dY[i][1] < 0.0)
             dY[i][1] = 0.0;
     }
-    else if (layers_ == 1)
+    else if (layers == 1)
     {
         // should never get here (see post_force)
         error->fix_error(FLERR, this, "Trying to reduce wuestite layer at low T");
@@ -1608,7 +1635,7 @@ void FixChemShrinkCore::reaction_low(int i, double *dmA_, const double *x0_eq_)
     dY[i][0] = dY[i][1];
 #endif
 
-    for (int j = 0 ; j < layers_; j++)
+    for (int j = 0 ; j < layers; j++)
     {
         // mass flow rate for reactant gas species
         // dmA is a positive value
@@ -1640,13 +1667,14 @@ void FixChemShrinkCore::FractionalReduction_low(int i)
 
 /* ---------------------------------------------------------------------- */
 
-void FixChemShrinkCore::getXi_low(int i, double *x0_eq_)
+void FixChemShrinkCore::getXi_low(int i, int layers, double *x0_eq_, double *Keq_)
 {
     const double kch2_ = xA_[i] + xC_[i];
 
-    for (int j = 0; j < layers_; j++)
+    for (int j = 0; j < layers; j++)
     {
-        x0_eq_[j]  =   kch2_/(1.0+K_eq_low(j,i));
+        Keq_[j]    =   K_eq_low(j,i);
+        x0_eq_[j]  =   kch2_/(1.0+Keq_[j]);
     }
 
 #ifdef TWO_LAYERS
@@ -1660,25 +1688,28 @@ void FixChemShrinkCore::getXi_low(int i, double *x0_eq_)
 /* ---------------------------------------------------------------------- */
 
 // 0 = magnetite interface, 1 = hematite interface
-void FixChemShrinkCore::getA_low(int i)
+// Keq_ are the equilibrium constants from getXi_low()
+void FixChemShrinkCore::getA_low(int i, int layers, const double *Keq_)
 {
-    if (strcmp(speciesA, "CO") == 0)
+    const double invRT = 1.0 / (Runiv * T_[i]);
+
+    if (reductant_ == REDUCTANT_CO)
     {
-        for (int j = 0; j < layers_ ; j++)
+        for (int j = 0; j < layers ; j++)
         {
-            Aterm[i][j] = (k0_low_CO[j] * exp(-Ea_low_CO[j] / (Runiv * T_[i])))
+            Aterm[i][j] = (k0_low_CO[j] * exp(-Ea_low_CO[j] * invRT))
                         * cbrt((1.0 - fracRed_[i][j]) * (1.0 - fracRed_[i][j]))
-                        * (1.0 + 1.0 / K_eq_low(j,i));
+                        * (1.0 + 1.0 / Keq_[j]);
             Aterm[i][j] = 1.0 / Aterm[i][j];
         }
     }
-    else if(strcmp(speciesA,"H2") == 0)
+    else if (reductant_ == REDUCTANT_H2)
     {
-        for (int j = 0; j < layers_ ; j++)
+        for (int j = 0; j < layers ; j++)
         {
-            Aterm[i][j] = (k0_low_H2[j] * exp(-Ea_low_H2[j] / (Runiv * T_[i])))
+            Aterm[i][j] = (k0_low_H2[j] * exp(-Ea_low_H2[j] * invRT))
                         * cbrt((1.0 - fracRed_[i][j]) * (1.0 - fracRed_[i][j]))
-                        * (1.0 + 1.0 / K_eq_low(j,i));
+                        * (1.0 + 1.0 / Keq_[j]);
             Aterm[i][j] = 1.0 / Aterm[i][j];
         }
     }
@@ -1754,9 +1785,9 @@ void FixChemShrinkCore::update_fix(int narg, char **arg)
     {
         if (mask[i] & groupbit)
         {
-            active_layers(i);
+            const int layers = active_layers(i);
             double m = 0.0;
-            for (int layer = 0 ; layer <= layers_; layer++)
+            for (int layer = 0 ; layer <= layers; layer++)
             {
                 m += massLayer_[i][layer];
             }
@@ -58,25 +58,25 @@ public:
  protected:
 
   int active_layers(int);   // calculate number of active layers per-particle
-  void calcMassLayer(int);  // calculate mass of layers per-particle
+  void calcMassLayer(int, int);  // calculate mass of layers per-particle
   void FractionalReduction(int); // calculate fractional reduction per-layer depending on layer radius
-  void getXi(int, double *);    // calculate molar equilibrium constant of reacting gas
+  void getXi(int, int, double *, double *);    // calculate molar equilibrium constant of reacting gas
   double K_eq(int, int); // calculate equilibrium constant based on the work of Valipour 2009
-  void getA(int);   // calculate chemical reaction resistance term
-  void getB(int);   // calculate diffusion resistance term
+  void getA(int, int, const double *);   // calculate chemical reaction resistance term
+  void getB(int, int);   // calculate diffusion resistance term
   void getMassT(int);   // calculate gas film mass transfer resistance term
-  void reaction(int, double *, const double *);   // calculate chemical reaction rate
+  void reaction(int, int, double *, const double *);   // calculate chemical reaction rate
   // update particle layers (relative radii, mass) depending on chemical reaction rate
-  void update_atom_properties(int, const double *, const double *, const double *);
+  void update_atom_properties(int, int, const double *, const double *, const double *);
   // update reactant and product gas masses depending on chemical reaction rate
   void update_gas_properties(int, const double *);
-  void heat_of_reaction(int, const double *, const double *, const double *);
+  void heat_of_reaction(int, int, const double *, const double *, const double *);
   double conv_enthalpy(const double *, int);
   double K_eq_low(int, int);
-  void reaction_low(int, double *, const double *);
+  void reaction_low(int, int, double *, const double *);
   void FractionalReduction_low(int);
-  void getXi_low(int, double *);
-  void getA_low(int);
+  void getXi_low(int, int, double *, double *);
+  void getA_low(int, int, const double *);
 
   // pre-defined variables for reduction process
   static double const Runiv; // universal gas constant
@@ -112,7 +112,7 @@ public:
   char *diffA;
   char *moleFracA, *moleFracC;
 
-  int layers_;          // current active layers
+  int reductant_;       // reducing agent speciesA, see REDUCTANT_*
   double minMolarFrac_;
   const double rmin_;   // radius below which layers are neglected
   char *speciesA, *speciesC;
@@ -360,6 +360,17 @@ void FixContactPropertyAtom::do_forward_comm()
     timer->stamp(TIME_COMM);
 }
 
+void FixContactPropertyAtom::do_forward_comm(int n, FixContactPropertyAtom **fixes)
+{
+    if (n < 1) return;
+    Fix **group = fixes[0]->comm->fix_group(n);
+    for (int i = 0; i < n; i++) group[i] = fixes[i];
+
+    fixes[0]->timer->stamp();
+    fixes[0]->comm->forward_comm_variable_fix_group(n,group);
+    fixes[0]->timer->stamp(TIME_COMM);
+}
+
 /* ---------------------------------------------------------------------- */
 
 int FixContactPropertyAtom::pack_comm(int n, int *list, double *buf,
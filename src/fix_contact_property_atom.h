@@ -78,6 +78,9 @@ class FixContactPropertyAtom : public FixContactHistory {
 
   void do_forward_comm();
 
+  // comm of several contact properties in one message per swap
+  static void do_forward_comm(int n, FixContactPropertyAtom **fixes);
+
   virtual class FixMeshSurface* getMesh() const
   { return NULL; }
 
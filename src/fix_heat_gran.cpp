@@ -28,6 +28,7 @@
 #include "group.h"
 #include "math_extra.h"
 #include "modify.h"
+#include "comm.h"
 #include "pair_gran.h"
 #include <stdlib.h>
 
@@ -181,8 +182,8 @@ void FixHeatGran::initial_integrate(int vflag)
      }
   }
 
-  //update ghosts
-  fix_directionalHeatFlux->do_forward_comm();
+  //update ghosts, deferred to the end of initial_integrate
+  comm->register_forward_fix(fix_directionalHeatFlux);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -379,8 +379,8 @@ void FixHeatGranCond::post_force_eval(int vflag,int cpl_flag)
   //NP only necessary in case of newton_pair=1, since pair stored once on all procs
   if(newton_pair)
   {
-    fix_heatFlux->do_reverse_comm();
-    fix_directionalHeatFlux->do_reverse_comm();
+    FixPropertyAtom *fixes[2] = { fix_heatFlux, fix_directionalHeatFlux };
+    FixPropertyAtom::do_reverse_comm(2,fixes);
   }
 }
 
@@ -34,10 +34,15 @@
 #include "force.h"
 #include "neighbor.h"
 #include "pair_gran.h"
-#include "random_mars.h"
+#include "random_park.h"
+#include "update.h"
 #include <cstdlib>
 #include <cstring>
 
+#if defined(_OPENMP)
+#include "omp.h"
+#endif
+
 using namespace LAMMPS_NS;
 using namespace FixConst;
 
@@ -113,14 +118,16 @@ FixHeatGranRad::FixHeatGranRad(class LAMMPS *lmp, int narg, char **arg) : FixHea
   if (seed == 0){
     error->fix_error(FLERR,this,"expecting keyword 'seed'");
   }
+  if (seed < 0){
+    error->fix_error(FLERR,this,"'seed' must be > 0");
+  }
   if (cutGhost == 0){
     error->fix_error(FLERR, this, "expecting keyword cutoff");
   }
 
-  RGen = new RanMars(lmp, seed + comm->me);
-
-  // for optimization of trace() preallocate these
-  raypoint = new double[3];
+  // random generators are created in init(), once # of threads is known
+  nRGen = 0;
+  RGen = NULL;
 
   stencilLength = NULL;
   binStencildx = NULL;
@@ -136,7 +143,6 @@ FixHeatGranRad::FixHeatGranRad(class LAMMPS *lmp, int narg, char **arg) : FixHea
 FixHeatGranRad::~FixHeatGranRad()
 {
   delete [] emissivity;
-  delete [] raypoint;
   delete [] stencilLength;
   delete [] binStencildx;
   delete [] binStencilmdx;
@@ -144,7 +150,9 @@ FixHeatGranRad::~FixHeatGranRad()
   delete [] binStencilmdy;
   delete [] binStencildz;
   delete [] binStencilmdz;
-  delete RGen;
+  for (int ithread = 0; ithread < nRGen; ithread++)
+    delete RGen[ithread];
+  delete [] RGen;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -197,6 +205,21 @@ void FixHeatGranRad::init()
   // error checks on coarsegraining
   if(force->cg_active())
     error->cg(FLERR,this->style);
+
+  // one generator for each thread, it is re-seeded for each ray
+  // package omp may change the # of threads between runs
+  const int nthreads = comm->nthreads;
+  if (nthreads != nRGen) {
+    RanPark **RGenNew = new RanPark*[nthreads];
+    for (int ithread = 0; ithread < nthreads; ithread++)
+      RGenNew[ithread] = (ithread < nRGen) ? RGen[ithread] :
+        new RanPark(lmp, seed);
+    for (int ithread = nthreads; ithread < nRGen; ithread++)
+      delete RGen[ithread];
+    delete [] RGen;
+    RGen = RGenNew;
+    nRGen = nthreads;
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -214,35 +237,12 @@ void FixHeatGranRad::setup(int i)
 
 void FixHeatGranRad::post_force(int vflag)
 {
-  //NP neighborlist data
-  int i;
-  int ibin;
-
   //NP particle data
   double **x;
   double *radius;
   int *type;
   int nlocal, nghost;
 
-  //NP ray data
-  double hitEmis;            //NP emissivity of hit particle
-  int hitId;                 //NP index of particle that was hit by ray
-  int hitBin;                //NP no of bin where particle has been hit by ray
-  double hitp[3]; //NP the point where a ray hit a particle
-  double nextNormal[3];
-
-  double *ci;                //NP center of one particle
-  double flux;               //NP energy of ray
-  double buffer3[3]; //NP buffer for computations in intersectRaySphere
-  double d[3]; //NP direction of ray
-  double o[3]; //NP origin of ray
-
-  //NP individual particle data
-  double areai; //NP area
-  double emisi; //NP emissivity
-  double radi;  //NP radius
-  double tempi; //NP temperature
-
   //NP fetch particle data
   nlocal = atom->nlocal;
   nghost = atom->nghost;
@@ -258,39 +258,66 @@ void FixHeatGranRad::post_force(int vflag)
   // }
 
   // all owned particles radiate
-  for (i = 0; i < nlocal + nghost; i++)
+  // rays are independent, so they are traced by all threads
+  // heat fluxes of hit particles are updated atomically
+  // the random stream of a ray is seeded from the timestep and the position
+  // of the radiating particle, so results do not depend on the # of threads
+  // or on which thread traces the ray
+
+  const int ntotal = nlocal + nghost;
+  const int ibase = static_cast<int>((seed + update->ntimestep) & MAXSMALLINT);
+
+#if defined(_OPENMP)
+  #pragma omp parallel for schedule(dynamic,64) default(shared) num_threads(nRGen)
+#endif
+  for (int i = 0; i < ntotal; i++)
   {
+#if defined(_OPENMP)
+    RanPark *rng = RGen[omp_get_thread_num()];
+#else
+    RanPark *rng = RGen[0];
+#endif
+    rng->reset(ibase,x[i]);
+
+    //NP ray data
+    double hitEmis;            //NP emissivity of hit particle
+    int hitId;                 //NP index of particle that was hit by ray
+    int hitBin;                //NP no of bin where particle has been hit by ray
+    double hitp[3]; //NP the point where a ray hit a particle
+    double nextNormal[3];
+    double buffer3[3]; //NP buffer for computations in intersectRaySphere
+    double d[3]; //NP direction of ray
+    double o[3]; //NP origin of ray
+
     // get basic data of atom
-    radi  = radius[i];
-    ci    = x[i];
-    emisi = emissivity[type[i]-1];
-    tempi = Temp[i];
+    const double radi  = radius[i];
+    const double *ci   = x[i];
+    const double emisi = emissivity[type[i]-1];
+    const double tempi = Temp[i];
 
     // check in which box we are in
-    ibin = neighbor->coord2bin(ci);
+    const int ibin = neighbor->coord2bin(x[i]);
 
     // calculate heat flux from this particle
-    areai = MY_4PI * radi * radi;
-    flux  = areai * emisi * Sigma * tempi * tempi * tempi * tempi;
+    const double areai = MY_4PI * radi * radi;
+    const double flux  = areai * emisi * Sigma * tempi * tempi * tempi * tempi;
 
     // let this particle radiate (flux is reduced)
-    heatFlux[i] -= flux;
+    addHeatFlux(i, -flux);
 
     // generate random point and direction
-    randOnSphere(ci, radi, o, buffer3);
-    randDir(buffer3, d);
+    randOnSphere(rng, ci, radi, o, buffer3);
+    randDir(rng, buffer3, d);
 
     // start radiating and tracing
-    // /*NL*/ printf("before trace (post_force)\n");
     hitId = trace(i, ibin, o, d, buffer3, hitp);
-    // /*NL*/ printf("after trace (post_force)\n");
 
     if (hitId != -1){ // the ray hit a particle: reflect from hit particle
 
       // update heatflux of particle j
       const double& sendflux = flux;
       hitEmis = emissivity[type[hitId]-1];
-      heatFlux[hitId] += hitEmis * sendflux;
+      addHeatFlux(hitId, hitEmis * sendflux);
 
       hitBin   = neighbor->coord2bin(x[hitId]);
 
@@ -299,15 +326,27 @@ void FixHeatGranRad::post_force(int vflag)
       normalize3(buffer3, nextNormal);
 
       // reflect ray at the hitpoint.
-      reflect(i, hitId, hitBin, hitp, nextNormal, sendflux, 1.0-hitEmis, maxBounces, buffer3);
+      reflect(rng, i, hitId, hitBin, hitp, nextNormal, sendflux, 1.0-hitEmis, maxBounces, buffer3);
 
     } else { // if a ray does not hit a particle we assume radiation from the background
       //NP TODO DEBUG ERROR
-      heatFlux[i] += (areai * emisi * Sigma * TB * TB * TB * TB);
+      addHeatFlux(i, areai * emisi * Sigma * TB * TB * TB * TB);
     }
   }
 }
 
+/* ----------------------------------------------------------------------
+   add to heat flux of a particle, may be hit by rays of several threads
+------------------------------------------------------------------------- */
+
+inline void FixHeatGranRad::addHeatFlux(int i, double q)
+{
+#if defined(_OPENMP)
+  #pragma omp atomic
+#endif
+  heatFlux[i] += q;
+}
+
 /* ----------------------------------------------------------------------
 
 // recursive method!
@@ -315,20 +354,20 @@ radID ... id of particle that originally radiated (source of energy)
 orig_id ... id of particle whereupon the ray was reflected (source of ray)
 
 ---------------------------------------------------------------------- */
-void FixHeatGranRad::reflect(int radID, int orig_id, int ibin, const double *o, const double *d,
+void FixHeatGranRad::reflect(RanPark *rng, int radID, int orig_id, int ibin, const double *o, const double *d,
   double flux, double accum_eps, int n, double *buffer3)
 {
   const double influx = flux * accum_eps;
 
   // base case
   if (n == 0){
-    heatFlux[radID] += influx;
+    addHeatFlux(radID, influx);
     return;
   }
 
   // if energy of one ray would be too small -> stop. //NP TODO: optimize this.
   if (accum_eps < 0.001){
-    heatFlux[radID] += influx;
+    addHeatFlux(radID, influx);
     return;
   }
 
@@ -339,7 +378,7 @@ void FixHeatGranRad::reflect(int radID, int orig_id, int ibin, const double *o,
   {
     double dd[3];
     // generate random (diffuse) direction
-    randDir(d, dd);
+    randDir(rng, d, dd);
 
     hitId = trace(orig_id, ibin, o, dd, buffer3, hitp);
   }
@@ -353,7 +392,7 @@ void FixHeatGranRad::reflect(int radID, int orig_id, int ibin, const double *o,
     const double hitEmis = emissivity[type[hitId]-1];
 
     // update heat flux for particle
-    heatFlux[hitId] += hitEmis * sendflux;
+    addHeatFlux(hitId, hitEmis * sendflux);
 
     // calculate new starting point for reflected ray
     int hitBin = neighbor->coord2bin(x[hitId]);
@@ -365,7 +404,7 @@ void FixHeatGranRad::reflect(int radID, int orig_id, int ibin, const double *o,
     norm3(nextNormal);
 
     // reflect ray at the hitpoint.
-    reflect(radID, hitId, hitBin, hitp, nextNormal, flux, (1.0-hitEmis) * accum_eps, n-1, buffer3);
+    reflect(rng, radID, hitId, hitBin, hitp, nextNormal, flux, (1.0-hitEmis) * accum_eps, n-1, buffer3);
   }
   else {
     const double *radius = atom->radius;
@@ -373,7 +412,7 @@ void FixHeatGranRad::reflect(int radID, int orig_id, int ibin, const double *o,
     const double radArea = MY_4PI * radRad * radRad;
     const double radEmis = emissivity[type[radID]-1];
     //NP TODO ERROR DEBUG
-    heatFlux[radID] += (radArea * radEmis * accum_eps * Sigma * TB * TB * TB * TB);
+    addHeatFlux(radID, radArea * radEmis * accum_eps * Sigma * TB * TB * TB * TB);
   }
 }
 
@@ -560,6 +599,7 @@ int FixHeatGranRad::trace(int orig_id, int ibin, const double *o, const double *
 
   // individual ray data
   double distsq, distx, disty, distz;
+  double raypoint[3];
   bool hit;
   double t;
 
@@ -592,6 +632,7 @@ int FixHeatGranRad::trace(int orig_id, int ibin, const double *o, const double *
 
     // number of new bins in direction of bin-hop
     var_nstencil = check_boundary_only ? nstencil2D : nstencil;
+    neighbor->bin2XYZ(currentBin, currX, currY, currZ);
 
     // walk the stencil of bins related to this bin, check all of their atoms
     for (int k = 0; k < var_nstencil; k++){
@@ -599,7 +640,6 @@ int FixHeatGranRad::trace(int orig_id, int ibin, const double *o, const double *
       // check if bin is inside domain of comm->me
       stencilbin = currentBin + currentStencil[k];
       neighbor->bin2XYZ(stencilbin, stbX, stbY, stbZ);
-      neighbor->bin2XYZ(currentBin, currX, currY, currZ);
       if (stencilbin < 0 || stencilbin >= mbins || abs(stbX - currX) > sx || abs(stbY - currY) > sy || abs(stbZ - currZ) > sz)
         continue;
 
@@ -853,6 +893,12 @@ bool FixHeatGranRad::intersectRaySphere(const double *o, const double *d, const
   B = 2.0 * dot3(buffer3, d);
   C = lensq3(buffer3) - radius*radius;
 
+  // cheap rejection: origin outside the sphere and ray points away from it
+  // both ts are negative then, saves the sqrt for most spheres of a stencil
+  if (C > 0.0 && B > 0.0){
+    return false;
+  }
+
   discr = B*B - 4.0*A*C;
 
   // miss
@@ -914,15 +960,15 @@ ansD ... return value - direction vector that points out of the sphere
  * 326.
  * see http://fossies.org/dox/gsl-2.6/sphere_8c_source.html#l00066
 */
-void FixHeatGranRad::randOnSphere(const double *c, double r, double *ansP, double *ansD)
+void FixHeatGranRad::randOnSphere(RanPark *rng, const double *c, double r, double *ansP, double *ansD)
 {
   double s;
 
   // generate random direction
   do
   {
-    ansD[0] = 2.0*RGen->uniform() - 1.0;
-    ansD[1] = 2.0*RGen->uniform() - 1.0;
+    ansD[0] = 2.0*rng->uniform() - 1.0;
+    ansD[1] = 2.0*rng->uniform() - 1.0;
     s = ansD[0]*ansD[0] + ansD[1]*ansD[1];
 
   } while (s > 1.0);
@@ -950,14 +996,14 @@ void FixHeatGranRad::randOnSphere(const double *c, double r, double *ansP, doubl
 * 326.
 * see http://fossies.org/dox/gsl-2.6/sphere_8c_source.html#l00066
 */
-void FixHeatGranRad::randDir(const double *n, double *d)
+void FixHeatGranRad::randDir(RanPark *rng, const double *n, double *d)
 {
   double s;
 
   do
   {
-    d[0] = 2.0*RGen->uniform() - 1.0;
-    d[1] = 2.0*RGen->uniform() - 1.0;
+    d[0] = 2.0*rng->uniform() - 1.0;
+    d[1] = 2.0*rng->uniform() - 1.0;
     s = d[0]*d[0] + d[1]*d[1];
 
   } while (s > 1.0);
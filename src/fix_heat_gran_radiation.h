@@ -50,9 +50,10 @@ namespace LAMMPS_NS {
     bool intersectRaySphere(const double *, const double *, const double *, double, double &, double *);
     int nextBin(int, const double *, const double *, double *, int &, int &, int &);
     int trace(int, int, const double *, const double *, double *, double *);
-    void randDir(const double *, double *);
-    void randOnSphere(const double *, double, double *, double *);
-    void reflect(int, int, int, const double *, const double *, double, double, int, double *);
+    void randDir(class RanPark *, const double *, double *);
+    void randOnSphere(class RanPark *, const double *, double, double *, double *);
+    void reflect(class RanPark *, int, int, int, const double *, const double *, double, double, int, double *);
+    inline void addHeatFlux(int, double);
     void updateQr();
     void createStencils();
 
@@ -72,11 +73,8 @@ namespace LAMMPS_NS {
 
     double Sigma;        // stefan bolzmann constant
     double Qtot;         // total radiative energy in the system
-    class RanMars *RGen; // random number generator
-
-    // pre-allocate these for optimization
-    double *raypoint;
-
+    class RanPark **RGen; // random number generator, one per thread
+    int nRGen;
     int *stencilLength;
     int *binStencildx;
     int *binStencilmdx;
@@ -620,6 +620,32 @@ int FixInsert::calc_ninsert_this()
   return ninsert_this;
 }
 
+/* ----------------------------------------------------------------------
+   expected number of bodies inserted after this step up to step
+   does not consume random numbers so insertion is not affected
+------------------------------------------------------------------------- */
+
+int FixInsert::predict_ninsert(bigint step)
+{
+  if (next_reneighbor <= 0 || next_reneighbor > step) return 0;
+
+  bigint nevents = 1;
+  if (insert_every > 0) nevents += (step - next_reneighbor) / insert_every;
+
+  double npredict = static_cast<double>(nevents) * ninsert_per;
+  if (ninsert_exists && ninserted + npredict > ninsert) npredict = ninsert - ninserted;
+
+  if (npredict <= 0.) return 0;
+  return static_cast<int>(npredict + 0.5);
+}
+
+/* ---------------------------------------------------------------------- */
+
+bool FixInsert::inserted_this_step() const
+{
+  return most_recent_ins_step == update->ntimestep;
+}
+
 /* ----------------------------------------------------------------------
    perform particle insertion
 ------------------------------------------------------------------------- */
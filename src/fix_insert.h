@@ -71,6 +71,12 @@ class FixInsert : public Fix {
   int ins_every()
   { return insert_every; }
 
+  // insertion prediction, used for load-balancing
+  virtual int predict_ninsert(bigint);
+  virtual bool insertion_volume(double *, double *) const
+  { return false; }
+  bool inserted_this_step() const;
+
  protected:
 
   int iarg;
@@ -235,36 +235,19 @@ void FixInsertPack::calc_region_volume_local()
 }
 
 /* ----------------------------------------------------------------------
-   number of particles to insert this timestep
-   depends on number of particles in region already
+   count particles, mass and occupied volume in insertion region on my proc
+   use all particles, not only those in the fix group
 ------------------------------------------------------------------------- */
 
-int FixInsertPack::calc_ninsert_this()
+void FixInsertPack::count_region(int &np_region, double &vol_region, double &mass_region)
 {
   int nlocal = atom->nlocal;
   double **x = atom->x;
   double *rmass = atom->rmass;
   double *radius = atom->radius;
 
-  int ninsert_this = 0;
-
-  // check if region extends outside simulation box
-  // if so, throw error if boundary setting is "f f f"
-
-  if(warn_region && ins_region->bbox_extends_outside_box())
-  {
-      for(int idim = 0; idim < 3; idim++)
-        for(int iface = 0; iface < 2; iface++)
-            if(domain->boundary[idim][iface] == 1)
-                error->fix_error(FLERR,this,"Insertion region extends outside simulation box and a fixed boundary is used."
-                            "Please use non-fixed boundaries in this case only");
-  }
-
-  // get number of particles, masss and occupied volume in insertion region
-  // use all particles, not only those in the fix group
-
-  int np_region = 0;
-  double vol_region = 0., mass_region = 0.;
+  np_region = 0;
+  vol_region = mass_region = 0.;
   double _4Pi3 = 4.*M_PI/3.;
 
   if(atom->molecular && atom->molecule_flag)
@@ -326,6 +309,87 @@ int FixInsertPack::calc_ninsert_this()
           }
       }
   }
+}
+
+/* ----------------------------------------------------------------------
+   expected number of particles missing in region at next insertion
+   same as calc_ninsert_this(), but without random contribution
+------------------------------------------------------------------------- */
+
+int FixInsertPack::predict_ninsert(bigint step)
+{
+  if (next_reneighbor <= 0 || next_reneighbor > step) return 0;
+
+  int np_region;
+  double vol_region, mass_region;
+  count_region(np_region,vol_region,mass_region);
+
+  double npredict = 0.;
+  if(volumefraction_region > 0.)
+  {
+      MPI_Sum_Scalar(vol_region,world);
+      npredict = (volumefraction_region*region_volume - vol_region) / fix_distribution->vol_expect();
+  }
+  else if(ntotal_region > 0)
+  {
+      MPI_Sum_Scalar(np_region,world);
+      npredict = ntotal_region - np_region;
+  }
+  else if(masstotal_region > 0.)
+  {
+      MPI_Sum_Scalar(mass_region,world);
+      npredict = (masstotal_region - mass_region) / fix_distribution->mass_expect();
+  }
+
+  // insertion stops once the total # of particles is reached
+
+  if(ninsert_exists && ninserted + npredict > ninsert) npredict = ninsert - ninserted;
+
+  if(npredict <= 0.) return 0;
+  return static_cast<int>(npredict + 0.5);
+}
+
+/* ---------------------------------------------------------------------- */
+
+bool FixInsertPack::insertion_volume(double *lo, double *hi) const
+{
+  if(!ins_region->bboxflag) return false;
+
+  lo[0] = ins_region->extent_xlo;
+  lo[1] = ins_region->extent_ylo;
+  lo[2] = ins_region->extent_zlo;
+  hi[0] = ins_region->extent_xhi;
+  hi[1] = ins_region->extent_yhi;
+  hi[2] = ins_region->extent_zhi;
+  return true;
+}
+
+/* ----------------------------------------------------------------------
+   number of particles to insert this timestep
+   depends on number of particles in region already
+------------------------------------------------------------------------- */
+
+int FixInsertPack::calc_ninsert_this()
+{
+  int ninsert_this = 0;
+
+  // check if region extends outside simulation box
+  // if so, throw error if boundary setting is "f f f"
+
+  if(warn_region && ins_region->bbox_extends_outside_box())
+  {
+      for(int idim = 0; idim < 3; idim++)
+        for(int iface = 0; iface < 2; iface++)
+            if(domain->boundary[idim][iface] == 1)
+                error->fix_error(FLERR,this,"Insertion region extends outside simulation box and a fixed boundary is used."
+                            "Please use non-fixed boundaries in this case only");
+  }
+
+  // get number of particles, masss and occupied volume in insertion region
+
+  int np_region;
+  double vol_region, mass_region;
+  count_region(np_region,vol_region,mass_region);
 
   // calculate and return number of particles that is missing
 
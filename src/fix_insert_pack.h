@@ -47,6 +47,9 @@ class FixInsertPack : public FixInsert {
   void init();
   virtual void restart(char *);
 
+  virtual int predict_ninsert(bigint);
+  virtual bool insertion_volume(double *, double *) const;
+
  protected:
 
   virtual void calc_insertion_properties();
@@ -55,6 +58,7 @@ class FixInsertPack : public FixInsert {
   void calc_region_volume_local();
 
   virtual int calc_ninsert_this();
+  void count_region(int &, double &, double &);
   virtual int calc_maxtry(int);
   void x_v_omega(int,int&,int&,double&);
   double insertion_fraction();
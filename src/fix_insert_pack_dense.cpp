@@ -50,6 +50,8 @@
 #include "bounding_box.h"
 #include "neighbor.h"
 #include "math_const.h"
+#include "comm.h"
+#include "mpi_liggghts.h"
 
 using namespace LAMMPS_NS;
 using namespace LIGGGHTS;
@@ -342,6 +344,10 @@ void FixInsertPackDense::pre_exchange()
     }
   }
 
+  // second phase: close the gaps at the subdomain boundaries
+  if (comm->nprocs > 1)
+    fill_seams();
+
   // actual insertion
   fix_distribution->pre_insert(n_inserted_local,fix_property,fix_property_value,property_index,fix_property_ivalue,property_iindex);
 
@@ -537,6 +543,203 @@ void FixInsertPackDense::handle_next_front_sphere()
   frontSpheres.pop();
 }
 
+/* ----------------------------------------------------------------------
+   each process packs its subdomain shrunk by maxrad, which leaves gaps
+   of 2*maxrad at the subdomain boundaries. these are filled process
+   by process: neighboring processes get different colors, and in each
+   color round the processes of that color grow the front from the
+   particles on both sides of their subdomain boundaries. particles
+   inserted in a round are sent to the neighbors before the next round
+------------------------------------------------------------------------- */
+
+void FixInsertPackDense::fill_seams()
+{
+  ParticleVector own, halo;
+
+  // particles present before the insertion and the ones packed so far
+
+  double halo_rad = maxrad;
+  for (int i = 0; i < atom->nlocal; i++) {
+    if (ins_region->match_expandby_cut(atom->x[i],atom->radius[i])) {
+      own.push_back(Particle(atom->x[i],atom->radius[i],atom->type[i]));
+      if (atom->radius[i] > halo_rad) halo_rad = atom->radius[i];
+    }
+  }
+  for (FixParticledistributionDiscrete::pti_list_type::iterator it = fix_distribution->pti_list.begin();
+       it != fix_distribution->pti_list.end(); ++it) {
+    ParticleToInsert *pti = *it;
+    own.push_back(Particle(pti->x_ins[0],pti->radius_ins[0]*radius_factor,pti->get_atom_type()));
+  }
+  MPI_Max_Scalar(halo_rad,world);
+
+  // a particle inserted at the subdomain boundary can overlap particles
+  // up to 2*halo_rad outside of it
+
+  double const cut = 3.*halo_rad;
+
+  // color the processor grid so that no two neighboring processes
+  // (including diagonal ones) have the same color; a periodic dimension
+  // with an odd number of processes needs a third color
+
+  int ncolor[3],color[3];
+  for (int dim = 0; dim < 3; dim++) {
+    if (comm->procgrid[dim] == 1) {
+      ncolor[dim] = 1;
+      color[dim] = 0;
+    } else if (domain->periodicity[dim] && comm->procgrid[dim] % 2) {
+      ncolor[dim] = 3;
+      color[dim] = (comm->myloc[dim] == comm->procgrid[dim]-1) ? 2 : comm->myloc[dim] % 2;
+    } else {
+      ncolor[dim] = 2;
+      color[dim] = comm->myloc[dim] % 2;
+    }
+  }
+  int const mycolor = color[0] + ncolor[0]*(color[1] + ncolor[1]*color[2]);
+  int const ncolor_all = ncolor[0]*ncolor[1]*ncolor[2];
+
+  // seam insertion box: the whole subdomain, except for dimensions that
+  // are not split, where the first phase already went up to maxrad
+
+  double sublo[3],subhi[3];
+  for (int dim = 0; dim < 3; dim++) {
+    sublo[dim] = domain->sublo[dim];
+    subhi[dim] = domain->subhi[dim];
+    if (comm->procgrid[dim] == 1) {
+      sublo[dim] += maxrad;
+      subhi[dim] -= maxrad;
+    }
+  }
+
+  BoundingBox seam_bbox(ins_region->extent_xlo,ins_region->extent_xhi,
+                        ins_region->extent_ylo,ins_region->extent_yhi,
+                        ins_region->extent_zlo,ins_region->extent_zhi);
+  seam_bbox.shrinkToSubbox(sublo,subhi);
+
+  double extent[3];
+  seam_bbox.getExtent(extent);
+  bool const has_seams = seam_bbox.hasVolume() &&
+    extent[0] >= 4.*halo_rad && extent[1] >= 4.*halo_rad && extent[2] >= 4.*halo_rad;
+
+  for (int icolor = 0; icolor < ncolor_all; icolor++) {
+
+    // collective: all processes take part in the halo exchange
+    exchange_halo(own,halo,cut);
+
+    if (icolor != mycolor || !has_seams) continue;
+
+    // neighbor list must hold the halo particles, so extend it by cut
+    BoundingBox neigh_bbox = seam_bbox;
+    neigh_bbox.extendByDelta(cut);
+
+    BoundingBox ins_bbox_packed = ins_bbox;
+    ins_bbox = seam_bbox;
+
+    neighlist.reset();
+    neighlist.setBoundingBox(neigh_bbox,halo_rad);
+    distfield.reset();
+    distfield.build(ins_region,ins_bbox,halo_rad);
+
+    for (ParticleVector::iterator it = own.begin(); it != own.end(); ++it)
+      neighlist.insert(it->x,it->radius,it->type);
+    for (ParticleVector::iterator it = halo.begin(); it != halo.end(); ++it)
+      neighlist.insert(it->x,it->radius,it->type);
+
+    // the front starts from the particles on both sides of the boundaries
+
+    for (ParticleVector::iterator it = halo.begin(); it != halo.end(); ++it)
+      frontSpheres.push(*it);
+    for (ParticleVector::iterator it = own.begin(); it != own.end(); ++it) {
+      for (int dim = 0; dim < 3; dim++) {
+        if (comm->procgrid[dim] > 1 &&
+            (it->x[dim] < domain->sublo[dim]+cut || it->x[dim] >= domain->subhi[dim]-cut)) {
+          frontSpheres.push(*it);
+          break;
+        }
+      }
+    }
+
+    int const n_before = n_inserted_local;
+    while (!frontSpheres.empty())
+      handle_next_front_sphere();
+
+    for (int i = n_before; i < n_inserted_local; i++) {
+      ParticleToInsert *pti = fix_distribution->pti_list[i];
+      own.push_back(Particle(pti->x_ins[0],pti->radius_ins[0]*radius_factor,pti->get_atom_type()));
+    }
+
+    if (screen)
+      fprintf(screen,"process %d : inserted %d particles at subdomain boundaries\n",
+              comm->me,n_inserted_local-n_before);
+
+    ins_bbox = ins_bbox_packed;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   send particles within cut of the subdomain boundaries to the
+   neighbor processes, as Comm::borders() does for ghost atoms:
+   dimension by dimension, forwarding particles received in previous
+   dimensions so that edge and corner neighbors are covered
+------------------------------------------------------------------------- */
+
+void FixInsertPackDense::exchange_halo(ParticleVector const &own, ParticleVector &halo, double const cut)
+{
+  halo.clear();
+
+  std::vector<double> sendbuf, recvbuf;
+
+  for (int dim = 0; dim < 3; dim++) {
+
+    // nothing to exchange if the dimension is not split
+    if (comm->procgrid[dim] == 1) continue;
+
+    // both directions send own particles and those received in previous dims
+    size_t const nhalo_prev = halo.size();
+    bool const periodic = domain->periodicity[dim];
+
+    for (int dir = 0; dir < 2; dir++) {
+
+      // dir 0 sends to the left and receives from the right, dir 1 vice versa
+      bool const edge_send = dir == 0 ? comm->myloc[dim] == 0 : comm->myloc[dim] == comm->procgrid[dim]-1;
+      bool const edge_recv = dir == 0 ? comm->myloc[dim] == comm->procgrid[dim]-1 : comm->myloc[dim] == 0;
+      int const sendproc = (edge_send && !periodic) ? MPI_PROC_NULL : comm->procneigh[dim][dir];
+      int const recvproc = (edge_recv && !periodic) ? MPI_PROC_NULL : comm->procneigh[dim][1-dir];
+
+      // particles sent across a periodic boundary are shifted by the box length
+      double shift = 0.;
+      if (edge_send && periodic) shift = dir == 0 ? domain->prd[dim] : -domain->prd[dim];
+
+      sendbuf.clear();
+      if (sendproc != MPI_PROC_NULL) {
+        for (size_t i = 0; i < own.size()+nhalo_prev; i++) {
+          Particle const &p = i < own.size() ? own[i] : halo[i-own.size()];
+          if (dir == 0 ? p.x[dim] < domain->sublo[dim]+cut : p.x[dim] >= domain->subhi[dim]-cut) {
+            sendbuf.push_back(p.x[0]);
+            sendbuf.push_back(p.x[1]);
+            sendbuf.push_back(p.x[2]);
+            sendbuf[sendbuf.size()-3+dim] += shift;
+            sendbuf.push_back(p.radius);
+            sendbuf.push_back(static_cast<double>(p.type));
+          }
+        }
+      }
+
+      int nsend = sendbuf.size();
+      int nrecv = 0;
+      MPI_Sendrecv(&nsend,1,MPI_INT,sendproc,0,
+                   &nrecv,1,MPI_INT,recvproc,0,world,MPI_STATUS_IGNORE);
+
+      recvbuf.resize(nrecv > 0 ? nrecv : 1);
+      if (sendbuf.empty()) sendbuf.push_back(0.);
+      MPI_Sendrecv(&sendbuf[0],nsend,MPI_DOUBLE,sendproc,0,
+                   &recvbuf[0],nrecv,MPI_DOUBLE,recvproc,0,world,MPI_STATUS_IGNORE);
+
+      for (int i = 0; i < nrecv; i += 5)
+        halo.push_back(Particle(&recvbuf[i],recvbuf[i+3],static_cast<int>(recvbuf[i+4])));
+    }
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixInsertPackDense::generate_initial_config(ParticleToInsert *&p1,
@@ -110,6 +110,10 @@ protected:
 
   void handle_next_front_sphere();
 
+  // fill the gaps left between the subdomains by the first phase
+  void fill_seams();
+  void exchange_halo(ParticleVector const &own, ParticleVector &halo, double const cut);
+
   void compute_and_append_candidate_points(LIGGGHTS::Particle const &p1,
                                            LIGGGHTS::Particle const &p2,
                                            LIGGGHTS::Particle const &p3,
@@ -545,6 +545,18 @@ inline int FixInsertStream::is_nearby(int i)
     return ins_face->isOnSurface(pos_projected);
 }
 
+/* ---------------------------------------------------------------------- */
+
+bool FixInsertStream::insertion_volume(double *lo, double *hi) const
+{
+  // bounding box of extruded face
+  vectorCopy3D(ins_vol_xmin,lo);
+  vectorCopy3D(ins_vol_xmax,hi);
+  return true;
+}
+
+/* ---------------------------------------------------------------------- */
+
 BoundingBox FixInsertStream::getBoundingBox() const {
   BoundingBox bb = ins_face->getGlobalBoundingBox();
 
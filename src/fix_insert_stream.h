@@ -65,6 +65,8 @@ class FixInsertStream : public FixInsert {
   virtual int release_step_index()
   { return 4; }
 
+  virtual bool insertion_volume(double *lo, double *hi) const;
+
  protected:
 
   virtual void calc_insertion_properties();
@@ -153,8 +153,8 @@ namespace LAMMPS_NS {
   }
   void FixLbCouplingOnetoone::comm_force_torque()
   {
-    fix_dragforce_->do_reverse_comm();
-    fix_hdtorque_->do_reverse_comm();
+    FixPropertyAtom *fixes[2] = { fix_dragforce_, fix_hdtorque_ };
+    FixPropertyAtom::do_reverse_comm(2,fixes);
   }
 
 
@@ -604,3 +604,19 @@ void FixMesh::box_extent(double &xlo,double &xhi,double &ylo,double &yhi,double
         }
     }
 }
+
+/* ----------------------------------------------------------------------
+   return pointer to mesh data, used by library interface
+   node = nodes of owned and ghost elements as [element][node][dim]
+------------------------------------------------------------------------- */
+
+void *FixMesh::extract(const char *name, int &dim)
+{
+    dim = 0;
+    if(strcmp(name,"node") == 0)
+    {
+        dim = 3;
+        return (void *) mesh_->nodePtr();
+    }
+    return NULL;
+}
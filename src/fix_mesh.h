@@ -64,6 +64,8 @@ namespace LAMMPS_NS
 
         void box_extent(double &xlo,double &xhi,double &ylo,double &yhi,double &zlo,double &zhi);
 
+        void *extract(const char *name, int &dim);
+
         int min_type() const;
         int max_type() const;
 
@@ -270,6 +270,22 @@ void FixMeshSurfaceStress::final_integrate()
 
 void FixMeshSurfaceStress::add_particle_contribution(int ip,double *frc,
                                 double *delta,int iTri,double *v_wall)
+{
+    add_contribution(ip,frc,delta,iTri,v_wall,
+                     trackStress() ? f(iTri) : 0,f_total_,torque_total_,
+                     trackWear() ? &wear_step(iTri) : 0);
+}
+
+/* ----------------------------------------------------------------------
+   add contribution of particle ip to triangle force f_tri, total force
+   and torque f_sum and torque_sum and triangle wear wear_tri
+   accumulation targets are passed so that threads can use own buffers
+------------------------------------------------------------------------- */
+
+void FixMeshSurfaceStress::add_contribution(int ip,double *frc,
+                                double *delta,int iTri,double *v_wall,
+                                double *f_tri,double *f_sum,
+                                double *torque_sum,double *wear_tri)
 {
     double E,c[3],v_rel[3],v_rel_mag,cos_gamma,sin_gamma,sin_2gamma;
     double contactPoint[3]={},surfNorm[3], tmp[3], tmp2[3];
@@ -290,15 +306,15 @@ void FixMeshSurfaceStress::add_particle_contribution(int ip,double *frc,
         /*NL*/ //if(screen) fprintf(screen,"step " BIGINT_FORMAT ", added force %f %f %f\n",update->ntimestep,frc[0],frc[1],frc[2]);
 
         // add contribution to triangle force
-        vectorAdd3D(f(iTri),frc,f(iTri));
+        vectorAdd3D(f_tri,frc,f_tri);
 
         // add contribution to total body force and torque
-        vectorAdd3D(f_total_,frc,f_total_);
+        vectorAdd3D(f_sum,frc,f_sum);
         vectorSubtract3D(contactPoint,p_ref_(0),tmp);
         /*NL*/ //if (screen) fprintf(screen,"p_ref_ %f %f %f\n",p_ref_(0)[0],p_ref_(0)[1],p_ref_(0)[2]);
         /*NL*/ //if (screen) fprintf(screen,"tmp %f %f %f\n",tmp[0],tmp[1],tmp[2]);
         vectorCross3D(tmp,frc,tmp2); // tmp2 is torque contrib
-        vectorAdd3D(torque_total_,tmp2,torque_total_);
+        vectorAdd3D(torque_sum,tmp2,torque_sum);
     }
 
     // add wear if applicable
@@ -360,7 +376,7 @@ void FixMeshSurfaceStress::add_particle_contribution(int ip,double *frc,
         //NP if (screen) fprintf(screen," k_finnie %f, vmag%f, frcmag %f ,wear %1.15f\n",k_finnie[atom_type_wall-1][atom->type[ip]-1],vmag,vectorMag3D(frc),E);
         //NP error->all("wear");
 
-        wear_step(iTri) += E*update->dt / triMesh()->areaElem(iTri);
+        *wear_tri += E*update->dt / triMesh()->areaElem(iTri);
     }
 }
 
@@ -407,10 +423,14 @@ void FixMeshSurfaceStress::calc_total_force()
     // calculate normal and shear stress
     if(trackStress())
     {
-        // total force and torque on mesh
-
-        MPI_Sum_Vector(f_total_,3,world);
-        MPI_Sum_Vector(torque_total_,3,world);
+        // total force and torque on mesh, summed in one message
+
+        double total[6];
+        vectorCopy3D(f_total_,&total[0]);
+        vectorCopy3D(torque_total_,&total[3]);
+        MPI_Sum_Vector(total,6,world);
+        vectorCopy3D(&total[0],f_total_);
+        vectorCopy3D(&total[3],torque_total_);
         /*NL*/ //if (screen) printVec3D(screen,"f_total_",f_total_);
 
         for(int i = 0; i < nTri; i++)
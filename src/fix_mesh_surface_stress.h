@@ -65,6 +65,11 @@ namespace LAMMPS_NS
         void add_global_external_contribution(double *frc);
         void add_global_external_contribution(double *frc,double *trq);
 
+        // true if add_particle_contribution() may be called
+        // concurrently from several threads
+        virtual bool threadsafeContribution()
+        { return false; }
+
         // inline access
 
         inline bool trackWear()
@@ -94,6 +99,10 @@ namespace LAMMPS_NS
         // total force and total torque
         double f_total_[3], torque_total_[3]; //NP modified A.A.: Need access for derived class
 
+        void add_contribution(int ip, double *frc, double *delta, int iTri,
+                              double *v_wall, double *f_tri, double *f_sum,
+                              double *torque_sum, double *wear_tri);
+
         // inline access
 
         inline double* f(int i)
@@ -1090,8 +1090,8 @@ void FixMultisphere::pre_neighbor()
     /*NL*/ //if (screen) fprintf(screen,"sum pre %f nlocal %d\n",sum,atom->nlocal);
 
     //NP need to send deletion flag from ghosts to owners
-    fix_delflag_->do_reverse_comm();
-    fix_existflag_->do_reverse_comm();
+    FixPropertyAtom *fixes[2] = { fix_delflag_, fix_existflag_ };
+    FixPropertyAtom::do_reverse_comm(2,fixes);
 
     /*NL*/ //sum = vectorSumN(existflag,atom->nlocal);
     /*NL*/ //if (screen) fprintf(screen,"sum post %f nlocal %d\n",sum,atom->nlocal);
@@ -0,0 +1,307 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "fix_neigh_autotune.h"
+#include "atom.h"
+#include "update.h"
+#include "neighbor.h"
+#include "timer.h"
+#include "force.h"
+#include "comm.h"
+#include "error.h"
+#include "mpi_liggghts.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+#define NSKIN 50           // # of candidate skins tested by the cost model
+#define SKIN_CHANGE 0.05   // relative change below which the skin is kept
+
+/* ---------------------------------------------------------------------- */
+
+FixNeighAutotune::FixNeighAutotune(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg),
+  every_max_(20),
+  safety_(0.5),
+  skinflag_(false),
+  skin_min_(0.),
+  skin_max_(0.),
+  step_last_(0),
+  ncalls_last_(0),
+  ndanger_last_(0),
+  nsteps_run_(0),
+  nbuilds_run_(0),
+  time_pair_run_(0.),
+  time_neigh_run_(0.),
+  time_pair_last_(0.),
+  time_neigh_last_(0.),
+  steps_per_build_(0.),
+  vmax_(0.),
+  skin_next_(0.)
+{
+  if (narg < 4)
+    error->fix_error(FLERR,this,"not enough arguments");
+
+  nevery = force->inumeric(FLERR,arg[3]);
+  if (nevery < 1)
+    error->fix_error(FLERR,this,"nevery must be > 0");
+
+  int iarg = 4;
+  bool hasargs = true;
+  while (iarg < narg && hasargs)
+  {
+    hasargs = false;
+    if (strcmp(arg[iarg],"every_max") == 0)
+    {
+      if (iarg+2 > narg)
+        error->fix_error(FLERR,this,"not enough arguments for 'every_max'");
+      every_max_ = force->inumeric(FLERR,arg[iarg+1]);
+      iarg += 2;
+      hasargs = true;
+    }
+    else if (strcmp(arg[iarg],"safety") == 0)
+    {
+      if (iarg+2 > narg)
+        error->fix_error(FLERR,this,"not enough arguments for 'safety'");
+      safety_ = force->numeric(FLERR,arg[iarg+1]);
+      iarg += 2;
+      hasargs = true;
+    }
+    else if (strcmp(arg[iarg],"skin") == 0)
+    {
+      if (iarg+3 > narg)
+        error->fix_error(FLERR,this,"not enough arguments for 'skin'");
+      skin_min_ = force->numeric(FLERR,arg[iarg+1]);
+      skin_max_ = force->numeric(FLERR,arg[iarg+2]);
+      skinflag_ = true;
+      iarg += 3;
+      hasargs = true;
+    }
+    else if (strcmp(style,"neigh/autotune") == 0)
+      error->fix_error(FLERR,this,"unknown keyword");
+  }
+
+  if (every_max_ < 1)
+    error->fix_error(FLERR,this,"'every_max' must be > 0");
+  if (safety_ <= 0. || safety_ > 1.)
+    error->fix_error(FLERR,this,"'safety' must be > 0 and <= 1");
+  if (skinflag_ && (skin_min_ <= 0. || skin_max_ < skin_min_))
+    error->fix_error(FLERR,this,"'skin' expects 0 < min <= max");
+
+  vector_flag = 1;
+  size_vector = 4;
+  global_freq = nevery;
+  extvector = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixNeighAutotune::~FixNeighAutotune()
+{
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixNeighAutotune::setmask()
+{
+  int mask = 0;
+  mask |= END_OF_STEP;
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixNeighAutotune::init()
+{
+  if (neighbor->dist_check == 0)
+    error->fix_error(FLERR,this,"requires neigh_modify check yes");
+}
+
+/* ----------------------------------------------------------------------
+   called after timer and neighbor counters are set up for the run
+   every is only tuned together with delay 0, since a non-zero delay
+   must be a multiple of every
+------------------------------------------------------------------------- */
+
+void FixNeighAutotune::setup(int)
+{
+  neighbor->delay = 0;
+
+  step_last_ = update->ntimestep;
+  ncalls_last_ = neighbor->ncalls;
+  ndanger_last_ = neighbor->ndanger;
+
+  nsteps_run_ = nbuilds_run_ = 0;
+  time_pair_run_ = time_neigh_run_ = 0.;
+  time_pair_last_ = timer->array[TIME_PAIR];
+  time_neigh_last_ = timer->array[TIME_NEIGHBOR];
+
+  skin_next_ = neighbor->skin;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixNeighAutotune::end_of_step()
+{
+  const bigint nsteps = update->ntimestep - step_last_;
+  const bigint nbuilds = neighbor->ncalls - ncalls_last_;
+  const bigint ndanger = neighbor->ndanger - ndanger_last_;
+  if (nsteps <= 0) return;
+
+  steps_per_build_ = nbuilds > 0 ? static_cast<double>(nsteps)/nbuilds :
+                                   static_cast<double>(nsteps);
+  vmax_ = max_velocity();
+
+  tune_every(vmax_,ndanger);
+
+  // average pair and neighbor time over procs
+
+  double dt_pair = timer->array[TIME_PAIR] - time_pair_last_;
+  double dt_neigh = timer->array[TIME_NEIGHBOR] - time_neigh_last_;
+  MPI_Sum_Scalar(dt_pair,world);
+  MPI_Sum_Scalar(dt_neigh,world);
+
+  nsteps_run_ += nsteps;
+  nbuilds_run_ += nbuilds;
+  time_pair_run_ += dt_pair/comm->nprocs;
+  time_neigh_run_ += dt_neigh/comm->nprocs;
+
+  if (skinflag_) tune_skin();
+
+  step_last_ = update->ntimestep;
+  ncalls_last_ = neighbor->ncalls;
+  ndanger_last_ = neighbor->ndanger;
+  time_pair_last_ = timer->array[TIME_PAIR];
+  time_neigh_last_ = timer->array[TIME_NEIGHBOR];
+}
+
+/* ----------------------------------------------------------------------
+   check the reneighboring criterion only as often as needed:
+   between two checks no atom may move more than safety * skin/2,
+   so a build is triggered before the list misses a contact
+   mesh motion is checked every step by fix mesh and is not affected
+   halve every after a dangerous build
+------------------------------------------------------------------------- */
+
+void FixNeighAutotune::tune_every(double vmax, bigint ndanger)
+{
+  const double dist = vmax * update->dt;
+  double every = every_max_;
+  if (dist > 0.) every = MIN(every,safety_*0.5*neighbor->skin/dist);
+
+  int every_new = MAX(1,static_cast<int>(every));
+  if (ndanger > 0) every_new = MIN(every_new,MAX(1,neighbor->every/2));
+
+  neighbor->every = every_new;
+}
+
+/* ----------------------------------------------------------------------
+   suggest the skin for the next run from the costs measured in this run
+   the pair and build costs scale with the # of neighbors, i.e. the
+   volume of the neighbor cutoff, and the # of steps between builds
+   grows linearly with the skin:
+     cost(s) = ((rc+s)/(rc+s0))^3 * (t_pair + t_build*s0/(R0*s))
+   rc = largest contact distance, s0 = current skin, t_pair = pair time
+   per step, t_build = time per build, R0 = measured steps per build
+------------------------------------------------------------------------- */
+
+void FixNeighAutotune::tune_skin()
+{
+  if (nsteps_run_ == 0 || nbuilds_run_ == 0) return;
+
+  const double skin = neighbor->skin;
+  const double rc = neighbor->cutneighmax - skin;
+  const double t_pair = time_pair_run_/nsteps_run_;
+  const double t_build = time_neigh_run_/nbuilds_run_;
+  const double R0 = static_cast<double>(nsteps_run_)/nbuilds_run_;
+
+  double cost_min = -1.;
+  for (int i = 0; i <= NSKIN; i++)
+  {
+    const double s = skin_min_ + (skin_max_-skin_min_)*i/NSKIN;
+    const double scale = (rc+s)/(rc+skin);
+    const double R = MAX(1.,R0*s/skin);
+    const double cost = scale*scale*scale * (t_pair + t_build/R);
+    if (cost_min < 0. || cost < cost_min)
+    {
+      cost_min = cost;
+      skin_next_ = s;
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double FixNeighAutotune::max_velocity()
+{
+  double **v = atom->v;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  double vmaxsq = 0.;
+  for (int i = 0; i < nlocal; i++)
+  {
+    if (!(mask[i] & groupbit)) continue;
+    const double vsq = v[i][0]*v[i][0] + v[i][1]*v[i][1] + v[i][2]*v[i][2];
+    if (vsq > vmaxsq) vmaxsq = vsq;
+  }
+  MPI_Max_Scalar(vmaxsq,world);
+  return sqrt(vmaxsq);
+}
+
+/* ----------------------------------------------------------------------
+   apply the suggested skin, it is used from the init() of the next run
+   on by neighbor, comm and the neighbor lists of mesh walls
+------------------------------------------------------------------------- */
+
+void FixNeighAutotune::post_run()
+{
+  if (!skinflag_) return;
+
+  const double skin = neighbor->skin;
+  if (fabs(skin_next_-skin) <= SKIN_CHANGE*skin) return;
+
+  neighbor->skin = skin_next_;
+
+  if (comm->me == 0)
+  {
+    if (screen)
+      fprintf(screen,"Fix neigh/autotune: neighbor skin changed from %g to %g for the next run\n",
+              skin,skin_next_);
+    if (logfile)
+      fprintf(logfile,"Fix neigh/autotune: neighbor skin changed from %g to %g for the next run\n",
+              skin,skin_next_);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   1 = neighbor every, 2 = steps per build, 3 = max velocity,
+   4 = skin suggested for the next run
+------------------------------------------------------------------------- */
+
+double FixNeighAutotune::compute_vector(int n)
+{
+  if (n == 0) return neighbor->every;
+  else if (n == 1) return steps_per_build_;
+  else if (n == 2) return vmax_;
+  return skinflag_ ? skin_next_ : neighbor->skin;
+}
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(neigh/autotune,FixNeighAutotune)
+
+#else
+
+#ifndef LMP_FIX_NEIGH_AUTOTUNE_H
+#define LMP_FIX_NEIGH_AUTOTUNE_H
+
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+class FixNeighAutotune : public Fix {
+ public:
+  FixNeighAutotune(class LAMMPS *, int, char **);
+  ~FixNeighAutotune();
+  int setmask();
+  void init();
+  void setup(int);
+  void end_of_step();
+  void post_run();
+  double compute_vector(int);
+
+ private:
+
+  void tune_every(double vmax, bigint ndanger);
+  void tune_skin();
+  double max_velocity();
+
+  int every_max_;           // upper limit for neighbor every
+  double safety_;           // fraction of half skin an atom may move between checks
+  bool skinflag_;           // true if skin is tuned for the next run
+  double skin_min_,skin_max_;
+
+  // counters at the last tuning step
+
+  bigint step_last_;
+  bigint ncalls_last_;
+  bigint ndanger_last_;
+
+  // statistics since the start of the run, used for the skin model
+
+  bigint nsteps_run_;
+  bigint nbuilds_run_;
+  double time_pair_run_;
+  double time_neigh_run_;
+  double time_pair_last_;
+  double time_neigh_last_;
+
+  double steps_per_build_;  // average # of steps between builds, last interval
+  double vmax_;             // max atom velocity at last tuning step
+  double skin_next_;        // skin suggested for the next run
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Fix neigh/autotune requires neigh_modify check yes
+
+The fix changes how often the reneighboring criterion is checked, so
+the criterion must be used.
+
+*/
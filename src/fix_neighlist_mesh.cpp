@@ -269,6 +269,11 @@ void FixNeighlistMesh::pre_force(int)
       generate_bin_list(nall);
     }
 
+    // update bins of triangles of moving mesh that moved too far
+    if(changingMesh && !changingDomain) {
+      update_moving_bins(nall);
+    }
+
     // manually trigger binning if no pairwise neigh lists exist
     if(0 == neighbor->n_blist() && bins)
         neighbor->bin_atoms();
@@ -347,7 +352,7 @@ void FixNeighlistMesh::handleTriangle(int iTri)
     // only do this if I own particles
     if(nlocal)
     {
-      if(changingMesh || changingDomain)
+      if(changingDomain)
       {
         getBinBoundariesForTriangle(iTri,ixMin,ixMax,iyMin,iyMax,izMin,izMax);
     /*NL*/ if(screen && DEBUGMODE_LMP_FIX_NEIGHLIST_MESH && DEBUG_LMP_FIX_NEIGHLIST_MESH_M_ID == mesh_->id(iTri))
@@ -478,8 +483,8 @@ void FixNeighlistMesh::getBinBoundariesFromBoundingBox(BoundingBox &b,
 
 void FixNeighlistMesh::getBinBoundariesForTriangle(int iTri, int &ixMin,int &ixMax,int &iyMin,int &iyMax,int &izMin,int &izMax)
 {
-  // disable optimization for movingMesh or shrink-wrapped domain
-  if(changingMesh || changingDomain) {
+  // disable optimization for shrink-wrapped domain
+  if(changingDomain) {
     BoundingBox b = mesh_->getElementBoundingBoxOnSubdomain(iTri);
     // extend bbox by cutneighmax and get bin boundaries
     getBinBoundariesFromBoundingBox(b,ixMin,ixMax,iyMin,iyMax,izMin,izMax);
@@ -507,53 +512,107 @@ void FixNeighlistMesh::post_run()
 void FixNeighlistMesh::generate_bin_list(size_t nall)
 {
   // precompute triangle bin boundaries
-  // disable optimization for changing mesh or domain
+  // disable optimization for changing domain
+  // for changing mesh, only invalidate bins, done in update_moving_bins()
   if (!(changingMesh || changingDomain)) {
-    double dx = neighbor->binsizex / 2.0;
-    double dy = neighbor->binsizey / 2.0;
-    double dz = neighbor->binsizez / 2.0;
-    double maxdiag = sqrt(dx * dx + dy * dy + dz * dz);
-
-    for (size_t iTri = 0; iTri < nall; iTri++) {
-      TriangleNeighlist & triangle = triangles[iTri];
-      std::vector<int> & binlist = triangle.bins;
-      binlist.clear();
-
-      BinBoundary& bb = triangle.boundary;
-      BoundingBox b = mesh_->getElementBoundingBoxOnSubdomain(iTri);
-
-      // extend bbox by cutneighmax and get bin boundaries
-      getBinBoundariesFromBoundingBox(b, bb.xlo, bb.xhi, bb.ylo, bb.yhi, bb.zlo, bb.zhi);
-
-      // look at bins and exclude unnecessary ones
-      double center[3];
-      int total = 0;
-      for (int ix = bb.xlo; ix <= bb.xhi; ix++) {
-        for (int iy = bb.ylo; iy <= bb.yhi; iy++) {
-          for (int iz = bb.zlo; iz <= bb.zhi; iz++) {
-            int iBin = iz * mbiny * mbinx + iy * mbinx + ix;
-            if (iBin < 0 || iBin >= maxhead)
-              continue;
-
-            // determine center of bin (ix, iy, iz)
-            neighbor->bin_center(ix, iy, iz, center);
-
-            if (mesh_->resolveTriSphereNeighbuild(iTri, maxdiag, center, distmax + skin))
-            {
-              binlist.push_back(iBin);
-            }
-            total++;
-          }
+    for (size_t iTri = 0; iTri < nall; iTri++)
+      generate_bins_for_triangle(iTri,0.);
+  } else if (!changingDomain) {
+    for (size_t iTri = 0; iTri < nall; iTri++)
+      triangles[iTri].bins_id = -1;
+  }
+
+  last_bin_update = update->ntimestep;
+}
+
+/* ----------------------------------------------------------------------
+   list bins that may contain particles in contact with triangle iTri
+   valid as long as no node of the triangle moves further than margin
+------------------------------------------------------------------------- */
+
+void FixNeighlistMesh::generate_bins_for_triangle(int iTri, double margin)
+{
+  double dx = neighbor->binsizex / 2.0;
+  double dy = neighbor->binsizey / 2.0;
+  double dz = neighbor->binsizez / 2.0;
+  double maxdiag = sqrt(dx * dx + dy * dy + dz * dz);
+
+  TriangleNeighlist & triangle = triangles[iTri];
+  std::vector<int> & binlist = triangle.bins;
+  binlist.clear();
+
+  BinBoundary& bb = triangle.boundary;
+  BoundingBox b;
+  double node[3];
+  for (int j = 0; j < 3; j++) {
+    mesh_->node(iTri,j,node);
+    b.extendToContain(node);
+  }
+  b.extendByDelta(margin);
+  b.shrinkToSubbox(domain->sublo,domain->subhi);
+
+  // extend bbox by cutneighmax and get bin boundaries
+  getBinBoundariesFromBoundingBox(b, bb.xlo, bb.xhi, bb.ylo, bb.yhi, bb.zlo, bb.zhi);
+
+  // look at bins and exclude unnecessary ones
+  double center[3];
+  int total = 0;
+  for (int ix = bb.xlo; ix <= bb.xhi; ix++) {
+    for (int iy = bb.ylo; iy <= bb.yhi; iy++) {
+      for (int iz = bb.zlo; iz <= bb.zhi; iz++) {
+        int iBin = iz * mbiny * mbinx + iy * mbinx + ix;
+        if (iBin < 0 || iBin >= maxhead)
+          continue;
+
+        // determine center of bin (ix, iy, iz)
+        neighbor->bin_center(ix, iy, iz, center);
+
+        if (mesh_->resolveTriSphereNeighbuild(iTri, maxdiag, center, distmax + skin + margin))
+        {
+          binlist.push_back(iBin);
         }
+        total++;
       }
-      /*NL*/ if (DEBUGMODE_LMP_FIX_NEIGHLIST_MESH && comm->me == 0 && screen) fprintf(screen, "triangle %lu bins: %lu / %d\n", iTri, binlist.size(), total);
-      /*NL*/ if (DEBUGMODE_LMP_FIX_NEIGHLIST_MESH && comm->me == 0 && logfile) fprintf(logfile, "triangle %lu bins: %lu / %d\n", iTri, binlist.size(), total);
     }
   }
+  /*NL*/ if (DEBUGMODE_LMP_FIX_NEIGHLIST_MESH && comm->me == 0 && screen) fprintf(screen, "triangle %d bins: %lu / %d\n", iTri, binlist.size(), total);
+  /*NL*/ if (DEBUGMODE_LMP_FIX_NEIGHLIST_MESH && comm->me == 0 && logfile) fprintf(logfile, "triangle %d bins: %lu / %d\n", iTri, binlist.size(), total);
+}
 
-  last_bin_update = update->ntimestep;
+/* ----------------------------------------------------------------------
+   re-generate bins of moving or deforming mesh only for triangles that
+   are new on this proc or whose nodes moved more than one skin
+   since their bins were generated, bins of other triangles are re-used
+   bins are generated with a margin of one skin to allow for this
+------------------------------------------------------------------------- */
+
+void FixNeighlistMesh::update_moving_bins(size_t nall)
+{
+  const double margin = neighbor->skin;
+  const double marginsq = margin*margin;
+  double node[3],del[3];
+
+  for (size_t iTri = 0; iTri < nall; iTri++) {
+    TriangleNeighlist & triangle = triangles[iTri];
+    bool rebin = triangle.bins_id != mesh_->id(iTri);
+
+    for (int j = 0; j < 3 && !rebin; j++) {
+      mesh_->node(iTri,j,node);
+      vectorSubtract3D(node,triangle.bins_node[j],del);
+      if (vectorMag3DSquared(del) > marginsq) rebin = true;
+    }
+
+    if (!rebin) continue;
+
+    generate_bins_for_triangle(iTri,margin);
+    triangle.bins_id = mesh_->id(iTri);
+    for (int j = 0; j < 3; j++)
+      mesh_->node(iTri,j,triangle.bins_node[j]);
+  }
 }
 
+/* ---------------------------------------------------------------------- */
+
 int FixNeighlistMesh::getSizeNumContacts()
 {
   return mesh_->sizeLocal() + mesh_->sizeGhost();
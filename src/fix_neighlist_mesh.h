@@ -60,7 +60,12 @@ struct TriangleNeighlist {
   BinBoundary boundary;
   int nchecked;
 
-  TriangleNeighlist() : nchecked(0) {}
+  // for moving meshes: triangle id and node positions the bins were
+  // generated for, id = -1 if the bins have to be re-generated
+  int bins_id;
+  double bins_node[3][3];
+
+  TriangleNeighlist() : nchecked(0), bins_id(-1) {}
 };
 
 class FixNeighlistMesh : public Fix
@@ -144,6 +149,8 @@ class FixNeighlistMesh : public Fix
     bigint last_bin_update;
 
     void generate_bin_list(size_t nall);
+    void generate_bins_for_triangle(int iTri, double margin);
+    void update_moving_bins(size_t nall);
 };
 
 } /* namespace LAMMPS_NS */
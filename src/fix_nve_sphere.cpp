@@ -24,7 +24,9 @@
 #include "domain.h" //NP modified GM
 #include "fix_property_atom.h"
 #include "fix_cfd_coupling_force_implicit.h"
+#include "fix_sleep.h"
 #include "modify.h"
+#include "neighbor.h"
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -39,7 +41,8 @@ FixNVESphere::FixNVESphere(LAMMPS *lmp, int narg, char **arg) :
   FixNVE(lmp, narg, arg),
   implicitIntegration_(false),
   fix_Ksl_(0),
-  fix_cfd_coupling_force_implicit_(0)
+  fix_cfd_coupling_force_implicit_(0),
+  fix_sleep_(0)
 {
   if (narg < 3) error->all(FLERR,"Illegal fix nve/sphere command");
 
@@ -121,6 +124,10 @@ void FixNVESphere::init()
     if (mask[i] & groupbit)
       if (radius[i] == 0.0)
         error->one(FLERR,"Fix nve/sphere requires extended particles");
+
+  // sleeping particles are at rest, no need to integrate them
+
+  fix_sleep_ = static_cast<FixSleep*>(modify->find_fix_style_strict("sleep",0));
 }
 
 /* ---------------------------------------------------------------------- */
@@ -140,8 +147,9 @@ void FixNVESphere::initial_integrate(int vflag)
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
   if (igroup == atom->firstgroup) nlocal = atom->nfirst;
+  const FixSleep * const fix_sleep = fix_sleep_;
   double invImpDenom;
-  double *Ksl;
+  double *Ksl = NULL;
   if (implicitIntegration_) Ksl = fix_Ksl_->vector_atom;
 
   // set timestep here since dt may have changed or come via rRESPA
@@ -150,6 +158,13 @@ void FixNVESphere::initial_integrate(int vflag)
   if (domain->dimension == 2) dtfrotate = dtf / 0.5; // for discs the formula is I=0.5*Mass*Radius^2
   else dtfrotate  = dtf / INERTIA;
 
+  // track max displacement since last neighbor list build if needed
+  // saves the extra pass over all atoms in Neighbor::check_distance()
+
+  const int track = neighbor->displacement_due(this);
+  double **xhold = track ? neighbor->displacement_xhold() : NULL;
+  double delx,dely,delz,rsq,dispsq = 0.0;
+
   // update v,x,omega for all particles
   // d_omega/dt = torque / inertia
 
@@ -157,7 +172,7 @@ void FixNVESphere::initial_integrate(int vflag)
   {
       for (int i = 0; i < nlocal; i++)
       {
-          if (mask[i] & groupbit)
+          if ((mask[i] & groupbit) && !(fix_sleep && fix_sleep->asleep(i)))
           {
               dtfm = dtf / rmass[i];
               v[i][0] += dtfm * f[i][0];
@@ -178,13 +193,24 @@ void FixNVESphere::initial_integrate(int vflag)
               omega[i][1] += dtirotate * torque[i][1];
               omega[i][2] += dtirotate * torque[i][2];
           }
+
+          // every local atom, also sleeping ones
+          // an atom may have moved since the last build before it fell asleep
+
+          if (xhold) {
+              delx = x[i][0] - xhold[i][0];
+              dely = x[i][1] - xhold[i][1];
+              delz = x[i][2] - xhold[i][2];
+              rsq = delx*delx + dely*dely + delz*delz;
+              if (rsq > dispsq) dispsq = rsq;
+          }
       }
   }
   else
   {
       for (int i = 0; i < nlocal; i++)
       {
-          if (mask[i] & groupbit)
+          if ((mask[i] & groupbit) && !(fix_sleep && fix_sleep->asleep(i)))
           {
               dtfm = dtf / rmass[i];
               v[i][0] += dtfm * f[i][0];
@@ -200,9 +226,22 @@ void FixNVESphere::initial_integrate(int vflag)
               omega[i][1] += dtirotate * torque[i][1];
               omega[i][2] += dtirotate * torque[i][2];
           }
+
+          // every local atom, also sleeping ones
+          // an atom may have moved since the last build before it fell asleep
+
+          if (xhold) {
+              delx = x[i][0] - xhold[i][0];
+              dely = x[i][1] - xhold[i][1];
+              delz = x[i][2] - xhold[i][2];
+              rsq = delx*delx + dely*dely + delz*delz;
+              if (rsq > dispsq) dispsq = rsq;
+          }
       }
   }
 
+  if (track) neighbor->report_displacement(dispsq);
+
   // update mu for dipoles
   // d_mu/dt = omega cross mu
   // renormalize mu to dipole length
@@ -239,8 +278,9 @@ void FixNVESphere::final_integrate()
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
   if (igroup == atom->firstgroup) nlocal = atom->nfirst;
+  const FixSleep * const fix_sleep = fix_sleep_;
   double invImpDenom;
-  double *Ksl;
+  double *Ksl = NULL;
   if (implicitIntegration_) Ksl = fix_Ksl_->vector_atom;
 
   // set timestep here since dt may have changed or come via rRESPA
@@ -256,7 +296,7 @@ void FixNVESphere::final_integrate()
   {
       for (int i = 0; i < nlocal; i++)
       {
-          if (mask[i] & groupbit)
+          if ((mask[i] & groupbit) && !(fix_sleep && fix_sleep->asleep(i)))
           {
               dtfm = dtf / rmass[i];
               v[i][0] += dtfm * f[i][0];
@@ -278,7 +318,7 @@ void FixNVESphere::final_integrate()
   {
       for (int i = 0; i < nlocal; i++)
       {
-          if (mask[i] & groupbit)
+          if ((mask[i] & groupbit) && !(fix_sleep && fix_sleep->asleep(i)))
           {
               dtfm = dtf / rmass[i];
               v[i][0] += dtfm * f[i][0];
@@ -302,6 +302,45 @@ void FixPropertyAtom::do_reverse_comm()
    timer->stamp(TIME_COMM);
 }
 
+/* ----------------------------------------------------------------------
+   forward and backward comm of several properties at once
+   all of them are sent in one message per swap instead of one each
+------------------------------------------------------------------------- */
+
+void FixPropertyAtom::do_forward_comm(int n, FixPropertyAtom **fixes)
+{
+    if (n < 1) return;
+    Fix **group = fixes[0]->comm->fix_group(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        if (!fixes[i]->commGhost)
+            fixes[i]->error->all(FLERR,"FixPropertyAtom: Faulty implementation - forward_comm invoked, but not registered");
+        group[i] = fixes[i];
+    }
+
+    fixes[0]->timer->stamp();
+    fixes[0]->comm->forward_comm_fix_group(n,group);
+    fixes[0]->timer->stamp(TIME_COMM);
+}
+
+void FixPropertyAtom::do_reverse_comm(int n, FixPropertyAtom **fixes)
+{
+    if (n < 1) return;
+    Fix **group = fixes[0]->comm->fix_group(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        if (!fixes[i]->commGhostRev)
+            fixes[i]->error->all(FLERR,"FixPropertyAtom: Faulty implementation - reverse_comm invoked, but not registered");
+        group[i] = fixes[i];
+    }
+
+    fixes[0]->timer->stamp();
+    fixes[0]->comm->reverse_comm_fix_group(n,group);
+    fixes[0]->timer->stamp(TIME_COMM);
+}
+
 /* ----------------------------------------------------------------------
    memory usage of local atom-based arrays
 ------------------------------------------------------------------------- */
@@ -439,6 +478,16 @@ int FixPropertyAtom::unpack_exchange(int nlocal, double *buf)
     return nvalues;
 }
 
+/* ----------------------------------------------------------------------
+   values are contiguous per atom, so AtomVec can pack them directly
+------------------------------------------------------------------------- */
+
+int FixPropertyAtom::exchange_field(double *&data)
+{
+    data = data_style ? array_atom[0] : vector_atom;
+    return nvalues;
+}
+
 /* ----------------------------------------------------------------------
    pack values in local atom-based arrays for restart file
 ------------------------------------------------------------------------- */
@@ -51,6 +51,10 @@ class FixPropertyAtom : public Fix {
   void do_forward_comm();
   void do_reverse_comm();
 
+  // comm of several properties in one message per swap
+  static void do_forward_comm(int n, FixPropertyAtom **fixes);
+  static void do_reverse_comm(int n, FixPropertyAtom **fixes);
+
   virtual Fix* check_fix(const char *varname,const char *svmstyle,int len1,int len2,const char *caller,bool errflag);
 
   double memory_usage();
@@ -69,6 +73,7 @@ class FixPropertyAtom : public Fix {
 
   int pack_exchange(int, double *);
   int unpack_exchange(int, double *);
+  int exchange_field(double *&);
   int pack_restart(int, double *);
   void unpack_restart(int, int);
   int size_restart(int);
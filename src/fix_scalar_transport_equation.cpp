@@ -30,6 +30,7 @@
 #include "update.h"
 #include "error.h"
 #include "modify.h"
+#include "comm.h"
 #include "neighbor.h"
 #include "neigh_list.h"
 #include "neigh_request.h"
@@ -306,7 +307,8 @@ void FixScalarTransportEquation::initial_integrate(int vflag)
   /*NL*/ //if (screen) fprintf(screen,"executing FixScalarTransportEquation::initial_integrate, flux[0] %f [1] %f\n",flux[0],flux[1]);
 
   //NP do forward comm to send quantity (calculated from last time-step) to ghost particles
-  fix_quantity->do_forward_comm();
+  //NP deferred to the end of initial_integrate, together with other fixes
+  comm->register_forward_fix(fix_quantity);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -0,0 +1,312 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+#include "fix_sleep.h"
+#include "atom.h"
+#include "update.h"
+#include "modify.h"
+#include "force.h"
+#include "comm.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+/* ---------------------------------------------------------------------- */
+
+FixSleep::FixSleep(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg),
+  vthresh_(-1.),
+  fthresh_(-1.),
+  nsteps_(10),
+  fix_counter_(0),
+  fix_force_ref_(0)
+{
+  if (!atom->sphere_flag)
+    error->fix_error(FLERR,this,"requires atom style sphere");
+
+  int iarg = 3;
+  bool hasargs = true;
+  while (iarg < narg && hasargs)
+  {
+    hasargs = false;
+    if (strcmp(arg[iarg],"velocity") == 0)
+    {
+      if (iarg+2 > narg)
+        error->fix_error(FLERR,this,"not enough arguments for 'velocity'");
+      vthresh_ = force->numeric(FLERR,arg[iarg+1]);
+      iarg += 2;
+      hasargs = true;
+    }
+    else if (strcmp(arg[iarg],"force") == 0)
+    {
+      if (iarg+2 > narg)
+        error->fix_error(FLERR,this,"not enough arguments for 'force'");
+      fthresh_ = force->numeric(FLERR,arg[iarg+1]);
+      iarg += 2;
+      hasargs = true;
+    }
+    else if (strcmp(arg[iarg],"nsteps") == 0)
+    {
+      if (iarg+2 > narg)
+        error->fix_error(FLERR,this,"not enough arguments for 'nsteps'");
+      nsteps_ = force->inumeric(FLERR,arg[iarg+1]);
+      iarg += 2;
+      hasargs = true;
+    }
+    else if (strcmp(style,"sleep") == 0)
+      error->fix_error(FLERR,this,"unknown keyword");
+  }
+
+  if (vthresh_ <= 0.)
+    error->fix_error(FLERR,this,"expecting keyword 'velocity' with value > 0");
+  if (fthresh_ <= 0.)
+    error->fix_error(FLERR,this,"expecting keyword 'force' with value > 0");
+  if (nsteps_ < 1)
+    error->fix_error(FLERR,this,"'nsteps' must be > 0");
+
+  scalar_flag = 1;
+  global_freq = 1;
+  extscalar = 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixSleep::~FixSleep()
+{
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSleep::post_create()
+{
+  fix_counter_ = static_cast<FixPropertyAtom*>(modify->find_fix_property("sleepCounter","property/atom","scalar",0,0,style,false));
+  if (!fix_counter_)
+  {
+    const char* fixarg[9];
+    fixarg[0]="sleepCounter";
+    fixarg[1]="all";
+    fixarg[2]="property/atom";
+    fixarg[3]="sleepCounter";
+    fixarg[4]="scalar";
+    fixarg[5]="yes";
+    fixarg[6]="no";
+    fixarg[7]="no";
+    fixarg[8]="0.";
+    fix_counter_ = modify->add_fix_property_atom(9,const_cast<char**>(fixarg),style);
+  }
+
+  fix_force_ref_ = static_cast<FixPropertyAtom*>(modify->find_fix_property("sleepForce","property/atom","vector",0,0,style,false));
+  if (!fix_force_ref_)
+  {
+    const char* fixarg[11];
+    fixarg[0]="sleepForce";
+    fixarg[1]="all";
+    fixarg[2]="property/atom";
+    fixarg[3]="sleepForce";
+    fixarg[4]="vector";
+    fixarg[5]="yes";
+    fixarg[6]="no";
+    fixarg[7]="no";
+    fixarg[8]="0.";
+    fixarg[9]="0.";
+    fixarg[10]="0.";
+    fix_force_ref_ = modify->add_fix_property_atom(11,const_cast<char**>(fixarg),style);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSleep::pre_delete(bool unfixflag)
+{
+  if (unfixflag && fix_counter_)
+    modify->delete_fix("sleepCounter");
+  if (unfixflag && fix_force_ref_)
+    modify->delete_fix("sleepForce");
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixSleep::setmask()
+{
+  int mask = 0;
+  mask |= POST_FORCE;
+  mask |= END_OF_STEP;
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSleep::init()
+{
+  // only one fix sleep, since it is referenced by Comm
+
+  if (modify->n_fixes_style_strict("sleep") > 1)
+    error->fix_error(FLERR,this,"More than one fix sleep");
+
+  if (strstr(update->integrate_style,"respa"))
+    error->fix_error(FLERR,this,"not compatible with run_style respa");
+
+  // sleeping atoms must not pick up forces after post_force() zeroed them,
+  // else they are moved while their ghosts are not updated
+
+  bool after = false;
+  for (int ifix = 0; ifix < modify->nfix; ifix++) {
+    if (modify->fix[ifix] == this) after = true;
+    else if (after && (modify->fmask[ifix] & POST_FORCE)) {
+      char errstr[512];
+      sprintf(errstr,"must be defined after all fixes that apply forces, "
+              "but fix %s is defined after it",modify->fix[ifix]->id);
+      error->fix_error(FLERR,this,errstr);
+    }
+  }
+
+  fix_counter_ = static_cast<FixPropertyAtom*>(modify->find_fix_property("sleepCounter","property/atom","scalar",0,0,style));
+  fix_force_ref_ = static_cast<FixPropertyAtom*>(modify->find_fix_property("sleepForce","property/atom","vector",0,0,style));
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSleep::setup(int vflag)
+{
+  post_force(vflag);
+}
+
+/* ----------------------------------------------------------------------
+   zero velocity, force and torque of an atom that falls asleep
+------------------------------------------------------------------------- */
+
+inline void FixSleep::freeze(int i)
+{
+  double **v = atom->v;
+  double **f = atom->f;
+  double **omega = atom->omega;
+  double **torque = atom->torque;
+
+  v[i][0] = v[i][1] = v[i][2] = 0.0;
+  f[i][0] = f[i][1] = f[i][2] = 0.0;
+  omega[i][0] = omega[i][1] = omega[i][2] = 0.0;
+  torque[i][0] = torque[i][1] = torque[i][2] = 0.0;
+}
+
+/* ----------------------------------------------------------------------
+   wake sleeping atoms if the force on them exceeds the threshold
+   zero force and torque of atoms that keep sleeping, so the integrator
+   does not move them
+   if pair gran skipped contacts between sleeping atoms on this step, the
+   force of a sleeping atom is compared to the one recorded when this
+   started instead, so a neighbor that wakes up wakes the atom as well
+   must come after all fixes that add forces
+------------------------------------------------------------------------- */
+
+void FixSleep::post_force(int vflag)
+{
+  double **f = atom->f;
+  double **torque = atom->torque;
+  double *counter = fix_counter_->vector_atom;
+  double **fref = fix_force_ref_->array_atom;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+  const double fthreshsq = fthresh_*fthresh_;
+  const bool skipped = comm->fresh_atoms() != NULL;
+
+  for (int i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit) || counter[i] < nsteps_) continue;
+
+    double fsq;
+    if (skipped && counter[i] > nsteps_) {
+      if (counter[i] < nsteps_+2) {
+        fref[i][0] = f[i][0];
+        fref[i][1] = f[i][1];
+        fref[i][2] = f[i][2];
+        counter[i] = nsteps_+2;
+      }
+      const double dfx = f[i][0] - fref[i][0];
+      const double dfy = f[i][1] - fref[i][1];
+      const double dfz = f[i][2] - fref[i][2];
+      fsq = dfx*dfx + dfy*dfy + dfz*dfz;
+    } else fsq = f[i][0]*f[i][0] + f[i][1]*f[i][1] + f[i][2]*f[i][2];
+
+    if (fsq > fthreshsq) {
+      counter[i] = 0.;
+      continue;
+    }
+
+    f[i][0] = f[i][1] = f[i][2] = 0.0;
+    torque[i][0] = torque[i][1] = torque[i][2] = 0.0;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   count calm steps of awake atoms, put atoms to sleep after nsteps
+   atoms that fell asleep last step have been sent to ghosts by now
+------------------------------------------------------------------------- */
+
+void FixSleep::end_of_step()
+{
+  double **v = atom->v;
+  double **f = atom->f;
+  double **omega = atom->omega;
+  double *radius = atom->radius;
+  double *counter = fix_counter_->vector_atom;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+  const double vthreshsq = vthresh_*vthresh_;
+  const double fthreshsq = fthresh_*fthresh_;
+
+  for (int i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+
+    if (counter[i] >= nsteps_) {
+      if (counter[i] < nsteps_+1) counter[i] = nsteps_+1;
+      continue;
+    }
+
+    const double vsq = v[i][0]*v[i][0] + v[i][1]*v[i][1] + v[i][2]*v[i][2];
+    const double wsq = (omega[i][0]*omega[i][0] + omega[i][1]*omega[i][1] +
+                        omega[i][2]*omega[i][2]) * radius[i]*radius[i];
+    const double fsq = f[i][0]*f[i][0] + f[i][1]*f[i][1] + f[i][2]*f[i][2];
+
+    if (vsq < vthreshsq && wsq < vthreshsq && fsq < fthreshsq) {
+      counter[i] += 1.;
+      if (counter[i] >= nsteps_) freeze(i);
+    } else counter[i] = 0.;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   # of sleeping atoms
+------------------------------------------------------------------------- */
+
+double FixSleep::compute_scalar()
+{
+  double *counter = fix_counter_->vector_atom;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  double nsleep = 0.;
+  for (int i = 0; i < nlocal; i++)
+    if ((mask[i] & groupbit) && counter[i] >= nsteps_) nsleep += 1.;
+
+  double nsleep_all;
+  MPI_Allreduce(&nsleep,&nsleep_all,1,MPI_DOUBLE,MPI_SUM,world);
+  return nsleep_all;
+}
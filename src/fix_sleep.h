@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(sleep,FixSleep)
+
+#else
+
+#ifndef LMP_FIX_SLEEP_H
+#define LMP_FIX_SLEEP_H
+
+#include "fix.h"
+#include "fix_property_atom.h"
+
+namespace LAMMPS_NS {
+
+class FixSleep : public Fix {
+ public:
+  FixSleep(class LAMMPS *, int, char **);
+  ~FixSleep();
+  void post_create();
+  void pre_delete(bool unfixflag);
+  int setmask();
+  void init();
+  void setup(int);
+  void post_force(int);
+  void end_of_step();
+  double compute_scalar();
+
+  // 1 if position and velocity of atom i are frozen since last step
+  // its ghost copies need not be refreshed by forward comm
+
+  inline bool asleep(int i) const
+  { return fix_counter_->vector_atom[i] > nsteps_; }
+
+ private:
+
+  inline void freeze(int i);
+
+  double vthresh_;          // sleep if velocity below this
+  double fthresh_;          // sleep if force below this, wake if above
+  int nsteps_;              // # of consecutive calm steps to fall asleep
+
+  // # of consecutive calm steps of each atom
+  // nsteps_ = falling asleep, ghosts receive final state once more
+  // nsteps_+1 = asleep
+  // nsteps_+2 = asleep, force without contacts to sleeping atoms recorded
+
+  class FixPropertyAtom *fix_counter_;
+
+  // force on a sleeping atom once pair gran skips its contacts with other
+  // sleeping atoms, it wakes up if the force deviates from this
+
+  class FixPropertyAtom *fix_force_ref_;
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.  You can use -echo screen as a
+command-line option when running LAMMPS to see the offending line.
+
+E: Fix sleep requires atom style sphere
+
+Self-explanatory.
+
+E: Fix sleep must be defined after all fixes that apply forces
+
+A fix that applies forces in post_force() is defined after fix sleep,
+so sleeping particles could be moved while their ghosts are not
+updated.  Define fix sleep after this fix.
+
+E: More than one fix sleep
+
+Only one fix sleep may be defined, since it is referenced by forward
+communication.
+
+*/
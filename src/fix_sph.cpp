@@ -91,10 +91,16 @@ void FixSph::init()
   mass_type = atom->avec->mass_type;
   int ntypes = atom->ntypes;
   // need a half neighbor list, built when ever re-neighboring occurs
+  // request the same kind of list as pair sph, i.e. a granular list
+  // if !mass_type, so the list is a copy of the pair list
 
   int irequest = neighbor->request((void *) this);
   neighbor->requests[irequest]->pair = 0;
   neighbor->requests[irequest]->fix = 1;
+  if (!mass_type) {
+    neighbor->requests[irequest]->half = 0;
+    neighbor->requests[irequest]->gran = 1;
+  }
 
   if (strcmp(update->integrate_style,"respa") == 0)
     nlevels_respa = ((Respa *) update->integrate)->nlevels;
@@ -44,6 +44,7 @@ andreas.aigner@jku.at
 #include "error.h"
 #include "sph_kernels.h"
 #include "fix_property_atom.h"
+#include "fix_sph_pressure.h"
 #include "timer.h"
 
 using namespace LAMMPS_NS;
@@ -52,7 +53,14 @@ using namespace FixConst;
 /* ---------------------------------------------------------------------- */
 
 FixSPHDensitySum::FixSPHDensitySum(LAMMPS *lmp, int narg, char **arg) :
-  FixSph(lmp, narg, arg)
+  FixSph(lmp, narg, arg),
+  fixPressure_(NULL),
+  cacheOffset_(NULL),
+  kernelCache_(NULL),
+  maxOffset_(0),
+  maxCache_(0),
+  cacheStep_(-1),
+  cacheLastcall_(-1)
 {
   int iarg = 0;
 
@@ -89,7 +97,8 @@ FixSPHDensitySum::FixSPHDensitySum(LAMMPS *lmp, int narg, char **arg) :
 
 FixSPHDensitySum::~FixSPHDensitySum()
 {
-
+  memory->destroy(cacheOffset_);
+  memory->destroy(kernelCache_);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -128,22 +137,65 @@ void FixSPHDensitySum::init()
 
   if(me == -1 && pres >= 0) error->fix_error(FLERR,this,"Fix sph/pressure has to be defined after sph/density/summation \n");
   if(pres == -1) error->fix_error(FLERR,this,"Requires to define a fix sph/pressure also \n");
+
+  fixPressure_ = static_cast<FixSPHPressure*>(modify->find_fix_style_strict("sph/pressure",0));
+  cacheStep_ = -1;
 }
 
 /* ---------------------------------------------------------------------- */
 
 void FixSPHDensitySum::post_integrate()
+{
+  // select the kernel once, so the summation loop is specialized for it
+
+  if (0) return;
+  #define SPH_KERNEL_CLASS
+  #define SPHKernel(kernel_id_,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+  else if (kernel_id == kernel_id_) post_integrate_kernel<kernel_id_>();
+  #include "style_sph_kernel.h"
+  #undef SPH_KERNEL_CLASS
+  #undef SPHKernel
+  else error->fix_error(FLERR,this,"unknown sph kernel");
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int KERNEL>
+void FixSPHDensitySum::post_integrate_kernel()
 {
   //template function for using per atom or per atomtype smoothing length
-  if (mass_type) post_integrate_eval<1>();
-  else post_integrate_eval<0>();
+  // kernel values can only be reused by pair sph if all pairs are summed
+
+  if (igroup == 0) {
+    if (mass_type) post_integrate_eval<1,1,KERNEL>();
+    else post_integrate_eval<0,1,KERNEL>();
+  } else {
+    if (mass_type) post_integrate_eval<1,0,KERNEL>();
+    else post_integrate_eval<0,0,KERNEL>();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   true if the kernel cache belongs to the current neighbor list ptr
+   and was computed with the same kernel
+------------------------------------------------------------------------- */
+
+bool FixSPHDensitySum::kernel_cache_valid(NeighList *ptr, int id) const
+{
+  return cacheStep_ == update->ntimestep &&
+         cacheLastcall_ == neighbor->lastcall &&
+         id == kernel_id &&
+         ptr->firstneigh == list->firstneigh &&
+         ptr->inum == list->inum;
 }
 
 /* ---------------------------------------------------------------------- */
 
-template <int MASSFLAG>
+template <int MASSFLAG, int CACHEFLAG, int KERNEL>
 void FixSPHDensitySum::post_integrate_eval()
 {
+  typedef SPH_KERNEL_NS::SPHKernelT<KERNEL> Kernel;
+
   int i,j,ii,jj,inum,jnum,itype,jtype;
   double xtmp,ytmp,ztmp,delx,dely,delz,rsq,r,s=0.,W;
   double sli,sliInv,slj,slCom,slComInv,cut,imass,jmass;
@@ -177,7 +229,7 @@ void FixSPHDensitySum::post_integrate_eval()
 
     // this gets a value for W at self, perform error check
 
-    W = SPH_KERNEL_NS::sph_kernel(kernel_id,0.,sli,sliInv);
+    W = Kernel::kernel(0.,sli,sliInv);
     if (W < 0.)
     {
       if (screen) fprintf(screen,"s = %f, W = %f\n",s,W);
@@ -201,6 +253,24 @@ void FixSPHDensitySum::post_integrate_eval()
   numneigh = list->numneigh;
   firstneigh = list->firstneigh;
 
+  if (CACHEFLAG) {
+    if (inum > maxOffset_) {
+      maxOffset_ = inum;
+      memory->destroy(cacheOffset_);
+      memory->create(cacheOffset_,maxOffset_,"sph/density/summation:cacheOffset_");
+    }
+    int ncache = 0;
+    for (ii = 0; ii < inum; ii++) {
+      cacheOffset_[ii] = ncache;
+      ncache += numneigh[ilist[ii]];
+    }
+    if (ncache > maxCache_) {
+      maxCache_ = ncache;
+      memory->destroy(kernelCache_);
+      memory->create(kernelCache_,3*maxCache_,"sph/density/summation:kernelCache_");
+    }
+  }
+
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
 
@@ -219,9 +289,12 @@ void FixSPHDensitySum::post_integrate_eval()
       sli = sl[i];
     }
 
+    double *kc = CACHEFLAG ? &kernelCache_[3*cacheOffset_[ii]] : NULL;
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
 
+      if (CACHEFLAG) kc[3*jj] = -1.;
       if (!(mask[j] & groupbit)) continue;
 
       if (MASSFLAG) {
@@ -235,7 +308,7 @@ void FixSPHDensitySum::post_integrate_eval()
       }
 
       slComInv = 1./slCom;
-      cut = slCom*kernel_cut;
+      cut = slCom*Kernel::kernel_cut();
 
       delx = xtmp - x[j][0];
       dely = ytmp - x[j][1];
@@ -251,13 +324,19 @@ void FixSPHDensitySum::post_integrate_eval()
 
       // this gets a value for W at self, perform error check
 
-      W = SPH_KERNEL_NS::sph_kernel(kernel_id,s,slCom,slComInv);
+      W = Kernel::kernel(s,slCom,slComInv);
       if (W < 0.)
       {
         if (screen) fprintf(screen,"s = %f, W = %f\n",s,W);
         error->one(FLERR,"Illegal kernel used, W < 0");
       }
 
+      if (CACHEFLAG) {
+        kc[3*jj] = r;
+        kc[3*jj+1] = W;
+        kc[3*jj+2] = Kernel::kernel_der(s,slCom,slComInv);
+      }
+
       // add contribution of neighbor
       // have a half neigh list, so do it for both if necessary
 
@@ -268,7 +347,16 @@ void FixSPHDensitySum::post_integrate_eval()
     }
   }
 
-  // rho is now correct, send to ghosts
+  if (CACHEFLAG) {
+    cacheStep_ = update->ntimestep;
+    cacheLastcall_ = neighbor->lastcall;
+  } else cacheStep_ = -1;
+
+  // rho is now correct, set pressure before sending both to ghosts
+  // in one forward comm, so pair sph sees the pressure of this step
+
+  fixPressure_->update_pressure();
+
   timer->stamp();
   comm->forward_comm();
   timer->stamp(TIME_COMM);
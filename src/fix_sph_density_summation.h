@@ -46,9 +46,25 @@ class FixSPHDensitySum : public FixSph {
   virtual void init();
   virtual void post_integrate();
 
+  // kernel values of the last summation, reused by pair sph
+  // 3 values (r,W,dW/ds) per neighbor list entry, r < 0 outside the kernel
+  // neighbors of ilist[ii] start at kernel_cache()[3*cache_offset()[ii]]
+
+  bool kernel_cache_valid(class NeighList *, int) const;
+  inline const int *cache_offset() const { return cacheOffset_; }
+  inline const double *kernel_cache() const { return kernelCache_; }
+
  private:
-  template <int> void post_integrate_eval();
+  template <int> void post_integrate_kernel();
+  template <int,int,int> void post_integrate_eval();
+
+  class FixSPHPressure *fixPressure_;
 
+  int *cacheOffset_;
+  double *kernelCache_;
+  int maxOffset_,maxCache_;
+  bigint cacheStep_;      // step of last summation with cache, -1 if none
+  bigint cacheLastcall_;  // neighbor->lastcall at that time
 };
 
 }
@@ -107,6 +107,7 @@ FixSPHPressure::FixSPHPressure(LAMMPS *lmp, int narg, char **arg) :
     else error->fix_error(FLERR,this,"Unknown style. Valid styles are 'absolut' or 'Tait' \n");
 
     kernel_flag = 0; // does not need any kernel
+    pressureStep_ = -1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -154,13 +155,27 @@ void FixSPHPressure::init()
 /* ---------------------------------------------------------------------- */
 
 void FixSPHPressure::pre_force(int vflag)
+{
+  // fix sph/density/summation sets the pressure right after the density
+  // so ghosts receive rho and p in the same forward comm
+
+  if (pressureStep_ == update->ntimestep) return;
+
+  update_pressure();
+}
+
+/* ----------------------------------------------------------------------
+   set pressure of owned atoms from their density
+------------------------------------------------------------------------- */
+
+void FixSPHPressure::update_pressure()
 {
   int *mask = atom->mask;
   double *rho = atom->rho;
   double *p = atom->p;
   int nlocal = atom->nlocal;
 
-  // already have updated ghost positions due to regular communication
+  pressureStep_ = update->ntimestep;
 
   // set pressure
 
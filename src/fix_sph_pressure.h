@@ -51,6 +51,7 @@ class FixSPHPressure : public FixSph {
   int setmask();
   void init();
   void pre_force(int);
+  void update_pressure();
 
   double return_rho0() {
     if (pressureStyle == PRESSURESTYLE_ABSOLUT) return 0;
@@ -60,6 +61,8 @@ class FixSPHPressure : public FixSph {
  private:
   int pressureStyle;
   double B,rho0,rho0inv,gamma,P0;
+
+  bigint pressureStep_; // last step pressure was set, e.g. by fix sph/density/summation
 };
 
 }
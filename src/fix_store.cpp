@@ -138,6 +138,16 @@ int FixStore::unpack_exchange(int nlocal, double *buf)
   return nvalues;
 }
 
+/* ----------------------------------------------------------------------
+   values are contiguous per atom, so AtomVec can pack them directly
+------------------------------------------------------------------------- */
+
+int FixStore::exchange_field(double *&data)
+{
+  data = vecflag ? vstore : astore[0];
+  return nvalues;
+}
+
 /* ----------------------------------------------------------------------
    pack values in local atom-based arrays for restart file
 ------------------------------------------------------------------------- */
@@ -38,6 +38,7 @@ class FixStore : public Fix {
   void copy_arrays(int, int, int);
   int pack_exchange(int, double *);
   int unpack_exchange(int, double *);
+  int exchange_field(double *&);
   int pack_restart(int, double *);
   void unpack_restart(int, int);
   int size_restart(int);
@@ -434,7 +434,7 @@ void FixStoreState::end_of_step()
       if (which[m] == COMPUTE) {
         Compute *compute = modify->compute[n];
         if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-          compute->compute_peratom();
+          compute->compute_peratom_timed();
           compute->invoked_flag |= INVOKED_PERATOM;
         }
 
@@ -61,6 +61,7 @@
 #include "fix_property_global.h"
 #include <vector>
 #include "granular_wall.h"
+#include "trace.h"
 #include <assert.h>
 #include <string>
 #include <sstream>
@@ -617,6 +618,8 @@ void FixWallGran::pre_force(int vflag)
 
 void FixWallGran::post_force(int vflag)
 {
+  TRACE_REGION("FixWallGran::post_force");
+
     computeflag_ = 1;
     shearupdate_ = 1;
     if (update->setupflag) shearupdate_ = 0;
@@ -692,8 +695,11 @@ void FixWallGran::post_force_wall(int vflag)
 
   if(meshwall_ == 1 && store_force_contact_)
   {
+    //NP contact forces of all meshes in one message per swap
+    meshforceContacts_.clear();
     for(int imesh = 0; imesh < n_FixMesh_; imesh++)
-        FixMesh_list_[imesh]->meshforceContact()->do_forward_comm();
+        meshforceContacts_.push_back(FixMesh_list_[imesh]->meshforceContact());
+    FixContactPropertyAtom::do_forward_comm(n_FixMesh_,&meshforceContacts_[0]);
   }
 }
 
@@ -222,6 +222,7 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   // references to mesh walls
   int n_FixMesh_;
   class FixMeshSurface **FixMesh_list_;
+  std::vector<class FixContactPropertyAtom*> meshforceContacts_; // comm group
   class FixRigid *fix_rigid_;
   int *body_;
   double *masstotal_;
@@ -288,51 +288,81 @@ void Image::clear()
 /* ----------------------------------------------------------------------
    merge image from each processor into one composite image
    done pixel by pixel, respecting depth buffer
-   hi procs send to lo procs, cascading down logarithmically
+   procs beyond the largest power of 2 first send to lower procs
+   then binary swap: in each round, pairs of procs split their current
+     pixel range in half, each composites the half it keeps with the
+     partner's pixels and sends the other half to the partner
+   each proc ends with 1/npow2 of the final image, which is gathered
+     to proc 0, so no proc receives more than one full image
 ------------------------------------------------------------------------- */
 
 void Image::merge()
 {
-  MPI_Request requests[3];
-  MPI_Status statuses[3];
-
-  int nhalf = 1;
-  while (nhalf < nprocs) nhalf *= 2;
-  nhalf /= 2;
-
-  while (nhalf) {
-    if (me < nhalf && me+nhalf < nprocs) {
-      MPI_Irecv(rgbcopy,npixels*3,MPI_BYTE,me+nhalf,0,world,&requests[0]);
-      MPI_Irecv(depthcopy,npixels,MPI_DOUBLE,me+nhalf,0,world,&requests[1]);
-      if (ssao)
-        MPI_Irecv(surfacecopy,npixels*2,MPI_DOUBLE,
-                  me+nhalf,0,world,&requests[2]);
-      if (ssao) MPI_Waitall(3,requests,statuses);
-      else MPI_Waitall(2,requests,statuses);
-
-      for (int i = 0; i < npixels; i++) {
-        if (depthBuffer[i] < 0 || (depthcopy[i] >= 0 &&
-                                   depthcopy[i] < depthBuffer[i])) {
-          depthBuffer[i] = depthcopy[i];
-          imageBuffer[i*3+0] = rgbcopy[i*3+0];
-          imageBuffer[i*3+1] = rgbcopy[i*3+1];
-          imageBuffer[i*3+2] = rgbcopy[i*3+2];
-          if (ssao) {
-            surfaceBuffer[i*2+0] = surfacecopy[i*2+0];
-            surfaceBuffer[i*2+1] = surfacecopy[i*2+1];
-          }
-        }
+  int npow2 = 1;
+  while (2*npow2 <= nprocs) npow2 *= 2;
+
+  if (me >= npow2) swap_pixels(me-npow2,0,npixels,0,0);
+  else if (me+npow2 < nprocs) swap_pixels(me+npow2,0,0,0,npixels);
+
+  int lo = 0;
+  int hi = npixels;
+
+  if (me < npow2) {
+    for (int bit = npow2/2; bit; bit /= 2) {
+      int mid = lo + (hi-lo)/2;
+      if (me & bit) {
+        swap_pixels(me^bit,lo,mid,mid,hi);
+        lo = mid;
+      } else {
+        swap_pixels(me^bit,mid,hi,lo,mid);
+        hi = mid;
       }
-
-    } else if (me >= nhalf && me < 2*nhalf) {
-      MPI_Send(imageBuffer,npixels*3,MPI_BYTE,me-nhalf,0,world);
-      MPI_Send(depthBuffer,npixels,MPI_DOUBLE,me-nhalf,0,world);
-      if (ssao) MPI_Send(surfaceBuffer,npixels*2,MPI_DOUBLE,me-nhalf,0,world);
     }
+  } else lo = hi = 0;
+
+  // gather pixel ranges of all procs to proc 0
+  // SSAO needs depth and surface of the full image as well
+
+  int range[2],*ranges = NULL;
+  int *counts = NULL,*displs = NULL;
+  range[0] = lo;
+  range[1] = hi;
+  if (me == 0) {
+    ranges = new int[2*nprocs];
+    counts = new int[nprocs];
+    displs = new int[nprocs];
+  }
+  MPI_Gather(range,2,MPI_INT,ranges,2,MPI_INT,0,world);
+
+  int nfields = ssao ? 3 : 1;
+  for (int ifield = 0; ifield < nfields; ifield++) {
+    int nper = (ifield == 0) ? 3 : ifield;
+    if (me == 0)
+      for (int iproc = 0; iproc < nprocs; iproc++) {
+        counts[iproc] = nper*(ranges[2*iproc+1]-ranges[2*iproc]);
+        displs[iproc] = nper*ranges[2*iproc];
+      }
 
-    nhalf /= 2;
+    if (ifield == 0) {
+      if (me == 0)
+        MPI_Gatherv(MPI_IN_PLACE,0,MPI_BYTE,imageBuffer,counts,displs,
+                    MPI_BYTE,0,world);
+      else MPI_Gatherv(&imageBuffer[3*lo],3*(hi-lo),MPI_BYTE,
+                       NULL,NULL,NULL,MPI_BYTE,0,world);
+    } else {
+      double *field = (ifield == 1) ? depthBuffer : surfaceBuffer;
+      if (me == 0)
+        MPI_Gatherv(MPI_IN_PLACE,0,MPI_DOUBLE,field,counts,displs,
+                    MPI_DOUBLE,0,world);
+      else MPI_Gatherv(&field[nper*lo],nper*(hi-lo),MPI_DOUBLE,
+                       NULL,NULL,NULL,MPI_DOUBLE,0,world);
+    }
   }
 
+  delete [] ranges;
+  delete [] counts;
+  delete [] displs;
+
   // extra SSAO enhancement
   // bcast full image to all procs
   // each works on subset of pixels
@@ -352,6 +382,60 @@ void Image::merge()
   }
 }
 
+/* ----------------------------------------------------------------------
+   send pixels [sendlo,sendhi) to proc partner
+   receive partner's pixels [keeplo,keephi) and composite them with mine
+   on equal depth, the pixel of the lower proc wins, as in a serial merge
+------------------------------------------------------------------------- */
+
+void Image::swap_pixels(int partner, int sendlo, int sendhi,
+                        int keeplo, int keephi)
+{
+  MPI_Request requests[3];
+  MPI_Status statuses[3];
+  int nrequest = 0;
+
+  int nkeep = keephi - keeplo;
+  int nsend = sendhi - sendlo;
+
+  if (nkeep) {
+    MPI_Irecv(&rgbcopy[3*keeplo],3*nkeep,MPI_BYTE,partner,0,world,
+              &requests[nrequest++]);
+    MPI_Irecv(&depthcopy[keeplo],nkeep,MPI_DOUBLE,partner,0,world,
+              &requests[nrequest++]);
+    if (ssao)
+      MPI_Irecv(&surfacecopy[2*keeplo],2*nkeep,MPI_DOUBLE,partner,0,world,
+                &requests[nrequest++]);
+  }
+
+  if (nsend) {
+    MPI_Send(&imageBuffer[3*sendlo],3*nsend,MPI_BYTE,partner,0,world);
+    MPI_Send(&depthBuffer[sendlo],nsend,MPI_DOUBLE,partner,0,world);
+    if (ssao)
+      MPI_Send(&surfaceBuffer[2*sendlo],2*nsend,MPI_DOUBLE,partner,0,world);
+  }
+
+  if (!nkeep) return;
+  MPI_Waitall(nrequest,requests,statuses);
+
+  int lowerflag = partner < me;
+
+  for (int i = keeplo; i < keephi; i++) {
+    if (depthcopy[i] < 0) continue;
+    if (depthBuffer[i] < 0 || depthcopy[i] < depthBuffer[i] ||
+        (lowerflag && depthcopy[i] == depthBuffer[i])) {
+      depthBuffer[i] = depthcopy[i];
+      imageBuffer[i*3+0] = rgbcopy[i*3+0];
+      imageBuffer[i*3+1] = rgbcopy[i*3+1];
+      imageBuffer[i*3+2] = rgbcopy[i*3+2];
+      if (ssao) {
+        surfaceBuffer[i*2+0] = surfacecopy[i*2+0];
+        surfaceBuffer[i*2+1] = surfacecopy[i*2+1];
+      }
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    draw simulation bounding box as 12 cylinders
 ------------------------------------------------------------------------- */
@@ -120,6 +120,7 @@ class Image : protected Pointers {
 
   void draw_pixel(int, int, double, double *, double*);
   void compute_SSAO();
+  void swap_pixels(int, int, int, int, int);
 
   // inline functions
 
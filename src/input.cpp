@@ -1418,16 +1418,7 @@ void Input::newton()
 
 void Input::modify_timing()
 {
-  int timing = 0;
-
-  if (narg == 1) {
-    if (strcmp(arg[0],"off") == 0) timing = 0;
-    else if (strcmp(arg[0],"on") == 0) timing = 1;
-    else if (strcmp(arg[0],"verbose") == 0) timing = 2;
-    else error->all(FLERR,"Illegal modify_timing command");
-  } else error->all(FLERR,"Illegal modify_timing command");
-
-  modify->timing = timing;
+  modify->set_timing(narg,arg);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -24,6 +24,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <vector>
 #include "memory.h"
 #include "input.h"
 #include "modify.h"
@@ -635,14 +636,18 @@ void InputMeshTri::meshtrifile_stl(class TriMesh *mesh)
 
   int nLines = 0, nLinesTri = 0;
 
-  while (1)
+  // triangles read by proc 0, as 9 coords and line number per triangle
+  std::vector<double> vertexList;
+  std::vector<int> lineList;
+
+  while (me == 0)
   {
     // read a line from input script
     // n = length of line including str terminator, 0 if end of file
     // if line ends in continuation char '&', concatenate next line
 
-    if (me == 0) {
-      m = 0;
+    m = 0;
+    {
       while (1) {
         if (maxline-m < 2) reallocate(line,maxline,0);
         if (fgets(&line[m],maxline-m,nonlammps_file) == NULL) {
@@ -663,20 +668,12 @@ void InputMeshTri::meshtrifile_stl(class TriMesh *mesh)
       }
     }
 
-    // bcast the line
     // if n = 0, end-of-file
-    // error if label_active is set, since label wasn't encountered
-    // if original input file, code is done
-    // else go back to previous input file
 
-    MPI_Bcast(&n,1,MPI_INT,0,world);
     if (n == 0) {
       break;
     }
 
-    if (n > maxline) reallocate(line,maxline,n);
-    MPI_Bcast(line,n,MPI_CHAR,0,world);
-
     // lines start with 1 (not 0)
     nLines++;
 
@@ -694,7 +691,7 @@ void InputMeshTri::meshtrifile_stl(class TriMesh *mesh)
     if (strcmp(arg[0],"solid") == 0)
     {
       if (insideSolidObject)
-        error->all(FLERR,"Corrupt or unknown STL file: New solid object begins without closing prior solid object.");
+        error->one(FLERR,"Corrupt or unknown STL file: New solid object begins without closing prior solid object.");
       insideSolidObject=true;
       if (me == 0 && screen && verbose_){
         fprintf(screen,"Solid body detected in STL file\n");
@@ -703,7 +700,7 @@ void InputMeshTri::meshtrifile_stl(class TriMesh *mesh)
     else if (strcmp(arg[0],"endsolid") == 0)
     {
       if (!insideSolidObject)
-        error->all(FLERR,"Corrupt or unknown STL file: End of solid object found, but no begin.");
+        error->one(FLERR,"Corrupt or unknown STL file: End of solid object found, but no begin.");
       insideSolidObject=false;
       if (me == 0 && screen && verbose_) {
         fprintf(screen,"End of solid body detected in STL file.\n");
@@ -714,38 +711,34 @@ void InputMeshTri::meshtrifile_stl(class TriMesh *mesh)
     else if (strcmp(arg[0],"facet") == 0)
     {
       if (insideFacet)
-        error->all(FLERR,"Corrupt or unknown STL file: New facet begins without closing prior facet.");
+        error->one(FLERR,"Corrupt or unknown STL file: New facet begins without closing prior facet.");
       if (!insideSolidObject)
-        error->all(FLERR,"Corrupt or unknown STL file: New facet begins outside solid object.");
+        error->one(FLERR,"Corrupt or unknown STL file: New facet begins outside solid object.");
       insideFacet = true;
 
       nLinesTri = nLines;
 
       // check for keyword normal belonging to facet
       if (strcmp(arg[1],"normal") != 0)
-        error->all(FLERR,"Corrupt or unknown STL file: Facet normal not defined.");
+        error->one(FLERR,"Corrupt or unknown STL file: Facet normal not defined.");
 
       // do not import facet normal (is calculated later)
     }
     else if (strcmp(arg[0],"endfacet") == 0)
     {
        if (!insideFacet)
-         error->all(FLERR,"Corrupt or unknown STL file: End of facet found, but no begin.");
+         error->one(FLERR,"Corrupt or unknown STL file: End of facet found, but no begin.");
        insideFacet = false;
        if (iVertex != 3)
-         error->all(FLERR,"Corrupt or unknown STL file: Number of vertices not equal to three (no triangle).");
+         error->one(FLERR,"Corrupt or unknown STL file: Number of vertices not equal to three (no triangle).");
 
       // add triangle to mesh
       //if (screen) printVec3D(screen,"vertex",vertices[0]);
       //if (screen) printVec3D(screen,"vertex",vertices[1]);
       //if (screen) printVec3D(screen,"vertex",vertices[2]);
-      if(size_exclusion_list_ > 0 && nLinesTri == exclusion_list_[i_exclusion_list_])
-      {
-         if(i_exclusion_list_ < size_exclusion_list_-1)
-            i_exclusion_list_++;
-      }
-      else
-         addTriangle(mesh,vertices[0],vertices[1],vertices[2],nLinesTri);
+      for (int j = 0; j < 3; j++)
+        vertexList.insert(vertexList.end(),vertices[j],vertices[j]+3);
+      lineList.push_back(nLinesTri);
 
       //if (me == 0 && screen) {
         //fprintf(screen,"  End of facet detected in in solid body.\n");
@@ -756,9 +749,9 @@ void InputMeshTri::meshtrifile_stl(class TriMesh *mesh)
     else if (strcmp(arg[0],"outer") == 0)
     {
       if (insideOuterLoop)
-        error->all(FLERR,"Corrupt or unknown STL file: New outer loop begins without closing prior outer loop.");
+        error->one(FLERR,"Corrupt or unknown STL file: New outer loop begins without closing prior outer loop.");
       if (!insideFacet)
-        error->all(FLERR,"Corrupt or unknown STL file: New outer loop begins outside facet.");
+        error->one(FLERR,"Corrupt or unknown STL file: New outer loop begins outside facet.");
       insideOuterLoop = true;
       iVertex = 0;
 
@@ -769,7 +762,7 @@ void InputMeshTri::meshtrifile_stl(class TriMesh *mesh)
     else if (strcmp(arg[0],"endloop") == 0)
     {
       if (!insideOuterLoop)
-        error->all(FLERR,"Corrupt or unknown STL file: End of outer loop found, but no begin.");
+        error->one(FLERR,"Corrupt or unknown STL file: End of outer loop found, but no begin.");
       insideOuterLoop=false;
       //if (me == 0 && screen) {
         //fprintf(screen,"    End of outer loop detected in facet.\n");
@@ -779,7 +772,7 @@ void InputMeshTri::meshtrifile_stl(class TriMesh *mesh)
     else if (strcmp(arg[0],"vertex") == 0)
     {
       if (!insideOuterLoop)
-        error->all(FLERR,"Corrupt or unknown STL file: Vertex found outside a loop.");
+        error->one(FLERR,"Corrupt or unknown STL file: Vertex found outside a loop.");
 
       //if (me == 0 && screen) {
         //fprintf(screen,"      Vertex found.\n");
@@ -791,10 +784,33 @@ void InputMeshTri::meshtrifile_stl(class TriMesh *mesh)
 
       iVertex++;
       if (iVertex > 3)
-        error->all(FLERR,"Corrupt or unknown STL file: Can not have more than 3 vertices "
+        error->one(FLERR,"Corrupt or unknown STL file: Can not have more than 3 vertices "
                           "in a facet (only triangular meshes supported).");
     }
   }
+
+  // bcast all triangles at once and add them to the mesh on all procs
+
+  int nTri = lineList.size();
+  MPI_Bcast(&nTri,1,MPI_INT,0,world);
+  vertexList.resize(9*nTri);
+  lineList.resize(nTri);
+  if (nTri) {
+    MPI_Bcast(&vertexList[0],9*nTri,MPI_DOUBLE,0,world);
+    MPI_Bcast(&lineList[0],nTri,MPI_INT,0,world);
+  }
+
+  for (int iTri = 0; iTri < nTri; iTri++)
+  {
+    double *v = &vertexList[9*iTri];
+    if(size_exclusion_list_ > 0 && lineList[iTri] == exclusion_list_[i_exclusion_list_])
+    {
+       if(i_exclusion_list_ < size_exclusion_list_-1)
+          i_exclusion_list_++;
+    }
+    else
+       addTriangle(mesh,&v[0],&v[3],&v[6],lineList[iTri]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -30,6 +30,9 @@
 #include "modify.h"
 #include "compute.h"
 #include "fix.h"
+#include "fix_property_atom.h"
+#include "fix_mesh.h"
+#include "abstract_mesh.h"
 #include "comm.h"
 #include "memory.h"
 #include "error.h"
@@ -175,6 +178,98 @@ void *lammps_extract_atom(void *ptr, const char *name)
   return lmp->atom->extract(name);
 }
 
+/* ----------------------------------------------------------------------
+   return data type of a per-atom entity returned by lammps_extract_atom()
+   0 for int, 1 for double, 2 for 64-bit int
+   returns -1 if Atom::extract() does not recognize the name
+------------------------------------------------------------------------- */
+
+int lammps_extract_atom_datatype(void *ptr, const char *name)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+  if (lmp->atom->extract(name) == NULL) return -1;
+
+  if (strcmp(name,"image") == 0) return (sizeof(tagint) == 8) ? 2 : 0;
+  if (strcmp(name,"id") == 0 || strcmp(name,"type") == 0 ||
+      strcmp(name,"mask") == 0 || strcmp(name,"molecule") == 0) return 0;
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   return # of values per atom of a per-atom entity
+   1 for a vector, e.g. radius, 3 for an array, e.g. x
+   returns -1 if Atom::extract() does not recognize the name
+------------------------------------------------------------------------- */
+
+int lammps_extract_atom_size(void *ptr, const char *name)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+  int len;
+  if (lmp->atom->extract(name,len) == NULL) return -1;
+  return len;
+}
+
+/* ----------------------------------------------------------------------
+   extract a pointer to the per-atom values of a fix property/atom
+   name = variable name of the property, as given in the fix command
+   count = # of values per atom, 1 for a vector, else an array
+   returns a pointer to the fix's internal storage, which the caller
+     can cast to (double *) for a vector or (double **) for an array
+   only the first nlocal atoms are owned by this proc
+   returns a NULL if no fix property/atom stores this property
+------------------------------------------------------------------------- */
+
+void *lammps_extract_fix_property_atom(void *ptr, const char *name, int *count)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+
+  Fix *fix = lmp->modify->find_fix_property(name,"property/atom","scalar",
+                                            0,0,"library",false);
+  if (fix) {
+    *count = 1;
+    return (void *) fix->vector_atom;
+  }
+
+  fix = lmp->modify->find_fix_property(name,"property/atom","vector",
+                                       0,0,"library",false);
+  if (fix) {
+    *count = fix->size_peratom_cols;
+    return (void *) fix->array_atom;
+  }
+
+  *count = 0;
+  return NULL;
+}
+
+/* ----------------------------------------------------------------------
+   extract a pointer to the node coordinates of a mesh
+   id = ID of a fix mesh, e.g. fix mesh/surface
+   returns # of owned and ghost elements in nlocal and nghost and
+     # of nodes per element in nnodes
+   returns a pointer to the mesh's internal storage, which the caller
+     can cast to (double ***) and index as [element][node][dim]
+   the storage of all elements is contiguous
+   returns a NULL if id is not the ID of a fix mesh
+------------------------------------------------------------------------- */
+
+void *lammps_extract_mesh_nodes(void *ptr, const char *id,
+                                int *nlocal, int *nghost, int *nnodes)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+
+  *nlocal = *nghost = *nnodes = 0;
+  FixMesh *fix = dynamic_cast<FixMesh *>(lmp->modify->find_fix_id(id));
+  if (!fix) return NULL;
+
+  AbstractMesh *mesh = fix->mesh();
+  *nlocal = mesh->sizeLocal();
+  *nghost = mesh->sizeGhost();
+  *nnodes = mesh->numNodes();
+
+  int dim;
+  return fix->extract("node",dim);
+}
+
 /* ----------------------------------------------------------------------
    extract a pointer to an internal LAMMPS compute-based entity
    id = compute ID
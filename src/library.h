@@ -37,6 +37,11 @@ void *lammps_extract_compute(void *, const char *, int, int);
 void *lammps_extract_fix(void *, const char *, int, int, int, int);
 void *lammps_extract_variable(void *, const char *, const char *);
 
+int lammps_extract_atom_datatype(void *, const char *);
+int lammps_extract_atom_size(void *, const char *);
+void *lammps_extract_fix_property_atom(void *, const char *, int *);
+void *lammps_extract_mesh_nodes(void *, const char *, int *, int *, int *);
+
 int lammps_get_natoms(void *);
 void lammps_gather_atoms(void *, const char *, int, int, void *);
 void lammps_scatter_atoms(void *, const char *, int, int, void *);
@@ -103,6 +103,11 @@ Modify::Modify(LAMMPS *lmp) : Pointers(lmp)
   compute = NULL;
 
   timing = 0;
+  trace_every = 0;
+  trace_fp = NULL;
+  ntrace = 0;
+  trace_last = trace_delta = NULL;
+  trace_wall = 0.0;
 
   // fill map with fixes listed in style_fix.h
 
@@ -171,6 +176,10 @@ Modify::~Modify()
   restart_deallocate();
   delete compute_map;
   delete fix_map;
+
+  if (trace_fp) fclose(trace_fp);
+  memory->destroy(trace_last);
+  memory->destroy(trace_delta);
 }
 
 /* ----------------------------------------------------------------------
@@ -370,7 +379,10 @@ void Modify::initial_integrate(int vflag)
   /*NL*/// if (screen) fprintf(screen,"proc %d executing initial_integrate for %s\n",
   /*NL*///                                      comm->me,fix[list_initial_integrate[i]]->style);
   /*NL*/// __debug__(lmp);}
-  call_method_on_fixes(&Fix::initial_integrate, vflag, list_initial_integrate, n_initial_integrate);
+  call_method_on_fixes(&Fix::initial_integrate, vflag, list_initial_integrate, n_initial_integrate, FIX_TIME_INITIAL_INTEGRATE);
+
+  // ghost properties registered by the fixes, all in one message per swap
+  comm->forward_comm_registered();
 }
 
 /* ----------------------------------------------------------------------
@@ -379,7 +391,7 @@ void Modify::initial_integrate(int vflag)
 
 void Modify::post_integrate()
 {
-  call_method_on_fixes(&Fix::post_integrate, list_post_integrate, n_post_integrate);
+  call_method_on_fixes(&Fix::post_integrate, list_post_integrate, n_post_integrate, FIX_TIME_POST_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -390,7 +402,7 @@ void Modify::pre_exchange()
 {
   /*NL*/ //if(667 == update->ntimestep && screen) fprintf(screen,"proc %d executing pre_exch for %s\n",
   /*NL*/ //                                     comm->me,fix[list_pre_exchange[i]]->style);
-  call_method_on_fixes(&Fix::pre_exchange, list_pre_exchange, n_pre_exchange);
+  call_method_on_fixes(&Fix::pre_exchange, list_pre_exchange, n_pre_exchange, FIX_TIME_PRE_EXCHANGE);
 }
 
 /* ----------------------------------------------------------------------
@@ -401,7 +413,7 @@ void Modify::pre_neighbor()
 {
   /*NL*/ //(update->ntimestep == 1254 && screen) fprintf(screen,"proc %d executing pre_neigh for %s\n",
   /*NL*/ //                                    comm->me,fix[list_pre_neighbor[i]]->style);
-  call_method_on_fixes(&Fix::pre_neighbor, list_pre_neighbor, n_pre_neighbor);
+  call_method_on_fixes(&Fix::pre_neighbor, list_pre_neighbor, n_pre_neighbor, FIX_TIME_PRE_NEIGHBOR);
 }
 
 /* ----------------------------------------------------------------------
@@ -412,7 +424,7 @@ void Modify::pre_force(int vflag)
 {
   /*NL*/// if(update->ntimestep > 54500 && screen) fprintf(screen,"proc %d executing pre_force for %s\n",
   /*NL*///                                     comm->me,fix[list_pre_force[i]]->style);
-  call_method_on_fixes(&Fix::pre_force, vflag, list_pre_force, n_pre_force);
+  call_method_on_fixes(&Fix::pre_force, vflag, list_pre_force, n_pre_force, FIX_TIME_PRE_FORCE);
 }
 
 /* ----------------------------------------------------------------------
@@ -425,7 +437,7 @@ void Modify::post_force(int vflag)
   /*NL*/// if (screen) fprintf(screen,"proc %d executing post_force for %s\n",
   /*NL*///                                      comm->me,fix[list_post_force[i]]->style);
   /*NL*/// __debug__(lmp);}
-  call_method_on_fixes_omp(&Fix::post_force, vflag, list_post_force, n_post_force, list_post_force_omp, n_post_force_omp);
+  call_method_on_fixes_omp(&Fix::post_force, vflag, list_post_force, n_post_force, list_post_force_omp, n_post_force_omp, FIX_TIME_POST_FORCE);
 }
 
 /* ----------------------------------------------------------------------
@@ -447,7 +459,7 @@ bool Modify::iterate_implicitly()
 
 void Modify::final_integrate()
 {
-  call_method_on_fixes(&Fix::final_integrate, list_final_integrate, n_final_integrate);
+  call_method_on_fixes(&Fix::final_integrate, list_final_integrate, n_final_integrate, FIX_TIME_FINAL_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -463,7 +475,7 @@ void Modify::end_of_step()
         const int ifix = list_end_of_step[i];
         fix[ifix]->begin_time_recording();
         fix[ifix]->end_of_step();
-        fix[ifix]->end_time_recording();
+        fix[ifix]->end_time_recording(FIX_TIME_END_OF_STEP);
       }
     }
   }
@@ -491,7 +503,7 @@ double Modify::thermo_energy()
       const int ifix = list_thermo_energy[i];
       fix[ifix]->begin_time_recording();
       energy += fix[ifix]->compute_scalar();
-      fix[ifix]->end_time_recording();
+      fix[ifix]->end_time_recording(FIX_TIME_THERMO_ENERGY);
     }
   }
   else
@@ -530,6 +542,7 @@ void Modify::initial_integrate_respa(int vflag, int ilevel, int iloop)
 {
   call_respa_method_on_fixes(&Fix::initial_integrate_respa, vflag, ilevel, iloop,
       list_initial_integrate_respa, n_initial_integrate_respa);
+  comm->forward_comm_registered();
 }
 
 /* ----------------------------------------------------------------------
@@ -1371,6 +1384,118 @@ bigint Modify::memory_usage()
   return bytes;
 }
 
+/* ----------------------------------------------------------------------
+   modify_timing command
+   optional trace keyword writes the time spent in each fix and compute
+   every N steps to a CSV file
+------------------------------------------------------------------------- */
+
+void Modify::set_timing(int narg, char **arg)
+{
+  if (narg < 1) error->all(FLERR,"Illegal modify_timing command");
+
+  if (strcmp(arg[0],"off") == 0) timing = 0;
+  else if (strcmp(arg[0],"on") == 0) timing = 1;
+  else if (strcmp(arg[0],"verbose") == 0) timing = 2;
+  else error->all(FLERR,"Illegal modify_timing command");
+
+  if (trace_fp) fclose(trace_fp);
+  trace_fp = NULL;
+  trace_every = 0;
+
+  int iarg = 1;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"trace") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal modify_timing command");
+      if (!timing) error->all(FLERR,"Modify_timing trace requires modify_timing on");
+      if (comm->me == 0) {
+        trace_fp = fopen(arg[iarg+1],"w");
+        if (trace_fp == NULL) {
+          char str[512];
+          sprintf(str,"Cannot open modify_timing trace file %s",arg[iarg+1]);
+          error->one(FLERR,str);
+        }
+      }
+      trace_every = 1;
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"every") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal modify_timing command");
+      if (!trace_every)
+        error->all(FLERR,"Modify_timing every requires the trace keyword");
+      trace_every = force->inumeric(FLERR,arg[iarg+1]);
+      if (trace_every <= 0) error->all(FLERR,"Illegal modify_timing command");
+      iarg += 2;
+    } else error->all(FLERR,"Illegal modify_timing command");
+  }
+}
+
+/* ----------------------------------------------------------------------
+   zero the recorded times of all fixes and computes, called by Timer::init
+   start a new section in the trace file
+------------------------------------------------------------------------- */
+
+void Modify::reset_timing()
+{
+  for (int i = 0; i < nfix; i++) fix[i]->reset_time_recording();
+  for (int i = 0; i < ncompute; i++) compute[i]->reset_time_recording();
+
+  if (!trace_every) return;
+
+  ntrace = nfix + ncompute;
+  memory->destroy(trace_last);
+  memory->destroy(trace_delta);
+  memory->create(trace_last,ntrace+1,"modify:trace_last");
+  memory->create(trace_delta,2*ntrace+1,"modify:trace_delta");
+  for (int i = 0; i < ntrace; i++) trace_last[i] = 0.0;
+  trace_wall = MPI_Wtime();
+
+  if (trace_fp) {
+    fprintf(trace_fp,"Step,Loop");
+    for (int i = 0; i < nfix; i++)
+      fprintf(trace_fp,",fix:%s:%s",fix[i]->id,fix[i]->style);
+    for (int i = 0; i < ncompute; i++)
+      fprintf(trace_fp,",compute:%s:%s",compute[i]->id,compute[i]->style);
+    fprintf(trace_fp,"\n");
+  }
+}
+
+/* ----------------------------------------------------------------------
+   write one line of the timing trace
+   time spent in each fix and compute since the last line, max over procs
+   Loop = wall time on proc 0 since the last line
+------------------------------------------------------------------------- */
+
+void Modify::write_timing_trace()
+{
+  if (ntrace != nfix + ncompute) return;
+
+  // trace_delta holds the local times in its 1st half
+  // and the max over procs in its 2nd half
+
+  for (int i = 0; i < nfix; i++)
+    trace_delta[i] = fix[i]->get_recorded_time();
+  for (int i = 0; i < ncompute; i++)
+    trace_delta[nfix+i] = compute[i]->get_recorded_time();
+
+  for (int i = 0; i < ntrace; i++) {
+    const double total = trace_delta[i];
+    trace_delta[i] -= trace_last[i];
+    trace_last[i] = total;
+  }
+
+  MPI_Reduce(trace_delta,&trace_delta[ntrace],ntrace,MPI_DOUBLE,MPI_MAX,0,world);
+
+  const double wall = MPI_Wtime();
+  if (trace_fp) {
+    fprintf(trace_fp,BIGINT_FORMAT ",%g",update->ntimestep,wall-trace_wall);
+    for (int i = 0; i < ntrace; i++)
+      fprintf(trace_fp,",%g",trace_delta[ntrace+i]);
+    fprintf(trace_fp,"\n");
+    fflush(trace_fp);
+  }
+  trace_wall = wall;
+}
+
 /* ======================================================================
    helper functions by Richard Berger (JKU)
 ========================================================================= */
@@ -1379,12 +1504,12 @@ bigint Modify::memory_usage()
    calls a member method on all fixes
 ------------------------------------------------------------------------- */
 
-void Modify::call_method_on_fixes(FixMethod method) {
+void Modify::call_method_on_fixes(FixMethod method, int which) {
   if(timing) {
     for (int i = 0; i < nfix; i++) {
       fix[i]->begin_time_recording();
       (fix[i]->*method)();
-      fix[i]->end_time_recording();
+      fix[i]->end_time_recording(which);
     }
   }
   else
@@ -1399,13 +1524,13 @@ void Modify::call_method_on_fixes(FixMethod method) {
    calls a member method on all fixes in the specified list
 ------------------------------------------------------------------------- */
 
-void Modify::call_method_on_fixes(FixMethod method, int *& ilist, int & inum) {
+void Modify::call_method_on_fixes(FixMethod method, int *& ilist, int & inum, int which) {
   if(timing) {
     for (int i = 0; i < inum; i++) {
       const int ifix = ilist[i];
       fix[ifix]->begin_time_recording();
       (fix[ifix]->*method)();
-      fix[ifix]->end_time_recording();
+      fix[ifix]->end_time_recording(which);
     }
   }
   else
@@ -1420,12 +1545,12 @@ void Modify::call_method_on_fixes(FixMethod method, int *& ilist, int & inum) {
    calls a member method with vflag parameter on all fixes
 ------------------------------------------------------------------------- */
 
-void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag) {
+void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag, int which) {
   if(timing) {
     for (int i = 0; i < nfix; i++) {
       fix[i]->begin_time_recording();
       (fix[i]->*method)(vflag);
-      fix[i]->end_time_recording();
+      fix[i]->end_time_recording(which);
     }
   }
   else
@@ -1441,13 +1566,13 @@ void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag) {
    specified list
 ------------------------------------------------------------------------- */
 
-void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum) {
+void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum, int which) {
   if(timing) {
     for (int i = 0; i < inum; i++) {
       const int ifix = ilist[i];
       fix[ifix]->begin_time_recording();
       (fix[ifix]->*method)(vflag);
-      fix[ifix]->end_time_recording();
+      fix[ifix]->end_time_recording(which);
     }
   }
   else
@@ -1464,7 +1589,7 @@ void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& i
    called in a parallel context
 ------------------------------------------------------------------------- */
 
-void Modify::call_method_on_fixes_omp(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum, int *& plist, int & pnum) {
+void Modify::call_method_on_fixes_omp(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum, int *& plist, int & pnum, int which) {
 #if defined(_OPENMP)
   if(timing) {
     int i = 0;
@@ -1473,7 +1598,7 @@ void Modify::call_method_on_fixes_omp(FixMethodWithVFlag method, int vflag, int
       if(!(fmask[ifix] & PARALLEL_OPENMP)) {
         fix[ifix]->begin_time_recording();
         (fix[ifix]->*method)(vflag);
-        fix[ifix]->end_time_recording();
+        fix[ifix]->end_time_recording(which);
       }
       else
       {
@@ -1494,7 +1619,7 @@ void Modify::call_method_on_fixes_omp(FixMethodWithVFlag method, int vflag, int
 
               #pragma omp single
               {
-                fix[ifix]->end_time_recording();
+                fix[ifix]->end_time_recording(which);
                 i++;
               }
             }
@@ -1542,7 +1667,7 @@ void Modify::call_method_on_fixes_omp(FixMethodWithVFlag method, int vflag, int
     }
   }
 #else
-  call_method_on_fixes(method, vflag, ilist, inum);
+  call_method_on_fixes(method, vflag, ilist, inum, which);
 #endif
 }
 
@@ -53,6 +53,8 @@ class Modify : protected Pointers {
   int *fmask;                // bit mask for when each fix is applied
 
   int timing;                // 1 if fix calls are timed
+  int trace_every;           // write timing trace every this many steps
+                             // 0 if no trace is written
 
   int ncompute,maxcompute;   // list of computes
   class Compute **compute;
@@ -140,6 +142,10 @@ class Modify : protected Pointers {
 
   bigint memory_usage();
 
+  void set_timing(int, char **);
+  void reset_timing();
+  void write_timing_trace();
+
   int fix_restart_in_progress();//NP modified C.K.
   bool have_restart_data(Fix *f);//NP modified C.K.
   void max_min_rad(double &maxrad,double &minrad); //NP modified C.K.
@@ -182,15 +188,21 @@ class Modify : protected Pointers {
   void list_init_compute();
 
 private:
-  inline void call_method_on_fixes(FixMethod method);
-  inline void call_method_on_fixes(FixMethod method, int *& ilist, int & inum);
-  inline void call_method_on_fixes(FixMethodWithVFlag method, int vflag);
-  inline void call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum);
-  inline void call_method_on_fixes_omp(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum, int *& plist, int & pnum);
+  inline void call_method_on_fixes(FixMethod method, int which = FIX_TIME_OTHER);
+  inline void call_method_on_fixes(FixMethod method, int *& ilist, int & inum, int which = FIX_TIME_OTHER);
+  inline void call_method_on_fixes(FixMethodWithVFlag method, int vflag, int which = FIX_TIME_OTHER);
+  inline void call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum, int which = FIX_TIME_OTHER);
+  inline void call_method_on_fixes_omp(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum, int *& plist, int & pnum, int which = FIX_TIME_OTHER);
 
   inline void call_respa_method_on_fixes(FixMethodRESPA2 method, int arg1, int arg2, int *& ilist, int & inum);
   inline void call_respa_method_on_fixes(FixMethodRESPA3 method, int arg1, int arg2, int arg3, int *& ilist, int & inum);
 
+  FILE *trace_fp;            // timing trace file, only on proc 0
+  int ntrace;                // # of fixes + computes in trace
+  double *trace_last;        // times when the trace was last written
+  double *trace_delta;
+  double trace_wall;
+
   typedef Compute *(*ComputeCreator)(LAMMPS *, int, char **);
   std::map<std::string,ComputeCreator> *compute_map;
 
@@ -126,6 +126,11 @@ namespace LAMMPS_NS
         void borders();
         void clearGhosts();
 
+        // fast path for rigidly moving mesh
+        bool isRigidMotion();
+        bool bordersStillValid();
+        void storeBordersState();
+
         bool checkBorderElementLeft(int,int,double,double);
         bool checkBorderElementRight(int,int,double,double);
 
@@ -171,6 +176,12 @@ namespace LAMMPS_NS
         int sendneed_[3][2];         // # of procs away I send elements to
         int maxneed_[3];             // max procs away any proc needs, per dim
         double half_atom_cut_;       // half atom neigh cut
+        double ghost_margin_;        // extra ghost cut for rigid motion
+
+        // state at last borders() - used for rigid motion fast path
+        double **center_last_borders_;
+        int maxcenter_last_borders_;
+        double sublo_last_borders_[3],subhi_last_borders_[3];
 
         int size_exchange_;          // # of per-element datums in exchange
         int size_forward_;           // # of per-element datums in forward comm
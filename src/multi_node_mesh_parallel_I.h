@@ -44,6 +44,9 @@
     maxsend_(0), maxrecv_(0),
     buf_send_(0), buf_recv_(0),
     half_atom_cut_(0.),
+    ghost_margin_(0.),
+    center_last_borders_(0),
+    maxcenter_last_borders_(0),
     size_exchange_(0),
     size_forward_(0),
     size_border_(0),
@@ -98,6 +101,8 @@
 
       this->memory->destroy(buf_send_);
       this->memory->destroy(buf_recv_);
+
+      this->memory->destroy(center_last_borders_);
   }
 
   /* ----------------------------------------------------------------------
@@ -298,6 +303,12 @@
        if(this->isMoving())
          half_atom_cut_+= this->neighbor->skin / 2.;
 
+       //NP for rigid motion, ghosts are moved along with owned elements, so
+       //NP add an extra skin to the ghost cutoff - this way, borders() can
+       //NP be skipped at re-neigh steps until elements have moved this far
+       ghost_margin_ = isRigidMotion() ? this->neighbor->skin : 0.;
+       half_atom_cut_ += ghost_margin_;
+
        // calculate maximum bounding radius of elements across all procs
        rBound_max = 0.;
        for(int i = 0; i < sizeLocal(); i++)
@@ -614,6 +625,8 @@
       // re-calculate properties for ghost particles
       refreshGhosts(1);
 
+      storeBordersState();
+
       // build mesh topology and neigh list
       //NP operations performed in parallel at this point
       //NP already have IDs at this point which is important
@@ -659,6 +672,16 @@
       //NP so need to refresh everything once
       if(!setupFlag && !this->isMoving() && !this->isDeforming() && !this->domain->box_change) return;
 
+      // rigidly moving mesh: movers apply the motion to owned and ghost
+      // elements, so only need to refresh as long as ghost margin holds
+      if(!setupFlag && bordersStillValid())
+      {
+          refreshOwned(setupFlag);
+          refreshGhosts(setupFlag);
+          postBorders();
+          return;
+      }
+
       // set-up mesh parallelism
       setup();
 
@@ -691,6 +714,8 @@
       // re-calculate properties for ghosts
       refreshGhosts(setupFlag);
 
+      storeBordersState();
+
       // stuff that should be done before resuming simulation
       postBorders();
 
@@ -704,6 +729,77 @@
       /*NL*///buildNeighbours();
   }
 
+  /* ----------------------------------------------------------------------
+   rigid motion fast path - mesh only translates and/or rotates
+  ------------------------------------------------------------------------- */
+
+  template<int NUM_NODES>
+  bool MultiNodeMeshParallel<NUM_NODES>::isRigidMotion()
+  {
+      return doParallellization_ && this->isMoving() && !this->isScaling() && !this->isDeforming();
+  }
+
+  /* ----------------------------------------------------------------------
+   check if ghosts and ownership from last borders() are still valid
+   true if no element has moved further than ghost_margin_ since then,
+   no element has left its subbox and subbox has not changed
+  ------------------------------------------------------------------------- */
+
+  template<int NUM_NODES>
+  bool MultiNodeMeshParallel<NUM_NODES>::bordersStillValid()
+  {
+      if(!isParallel_ || ghost_margin_ <= 0. || !isRigidMotion() || this->domain->box_change)
+        return false;
+
+      int flag = 0;
+      const double marginSq = ghost_margin_*ghost_margin_;
+
+      //NP sub-box might have changed, e.g. due to load-balancing
+      for(int dim = 0; dim < 3; dim++)
+      {
+          if(this->domain->sublo[dim] != sublo_last_borders_[dim] ||
+             this->domain->subhi[dim] != subhi_last_borders_[dim])
+            flag = 1;
+      }
+
+      //NP ghosts move exactly as their owned counterpart, so need to check
+      //NP only owned elements
+      if(nLocal_ > maxcenter_last_borders_)
+        flag = 1;
+
+      for(int i = 0; i < nLocal_ && !flag; i++)
+      {
+          double delta[3];
+          vectorSubtract3D(this->center_(i),center_last_borders_[i],delta);
+          if(vectorMag3DSquared(delta) > marginSq || !this->domain->is_in_subdomain(this->center_(i)))
+            flag = 1;
+      }
+
+      MPI_Max_Scalar(flag,this->world);
+
+      return flag == 0;
+  }
+
+  /* ----------------------------------------------------------------------
+   store element centers and subbox at borders()
+  ------------------------------------------------------------------------- */
+
+  template<int NUM_NODES>
+  void MultiNodeMeshParallel<NUM_NODES>::storeBordersState()
+  {
+      vectorCopy3D(this->domain->sublo,sublo_last_borders_);
+      vectorCopy3D(this->domain->subhi,subhi_last_borders_);
+
+      if(nLocal_ > maxcenter_last_borders_)
+      {
+          maxcenter_last_borders_ = nLocal_;
+          this->memory->grow(center_last_borders_,maxcenter_last_borders_,3,"MultiNodeMeshParallel:center_last_borders_");
+      }
+
+      for(int i = 0; i < nLocal_; i++)
+          vectorCopy3D(this->center_(i),center_last_borders_[i]);
+  }
+
   /* ----------------------------------------------------------------------
    parallelization - clear data of reverse comm properties
   ------------------------------------------------------------------------- */
@@ -0,0 +1,287 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include "neighbor.h"
+#include "neigh_list.h"
+#include "neigh_multi_level_grid.h"
+#include "atom.h"
+#include "modify.h"
+#include "fix_contact_history.h"
+#include "my_page.h"
+#include "error.h"
+#include "mpi_liggghts.h"
+
+using namespace LAMMPS_NS;
+
+#define MAXLEVELS 8
+
+/* ----------------------------------------------------------------------
+   number of levels of the multi-level grid, 0 if not used
+------------------------------------------------------------------------- */
+
+int Neighbor::multi_levels()
+{
+  if (!mlg) return 0;
+  return mlg->nlevels();
+}
+
+/* ----------------------------------------------------------------------
+   radius range and number of levels for the multi-level grid
+   radius bound doubles per level, so a 1:20 size ratio gives 5 levels
+   must be called on all procs
+------------------------------------------------------------------------- */
+
+void Neighbor::multi_levels(double &maxrad, double &minrad, int &nlevels)
+{
+  modify->max_min_rad(maxrad,minrad);
+
+  // radii may have grown beyond those of the particle templates
+
+  if (atom->radvary_flag) maxrad = MAX(maxrad,multi_maxrad_atoms());
+
+  // no particles and no particle templates yet
+
+  if (maxrad <= 0. || minrad > maxrad) {
+    maxrad = minrad = MAX(0.,0.5*(cutneighmax-skin)/contactDistanceFactor);
+    nlevels = 1;
+    return;
+  }
+
+  nlevels = 1;
+  double r = 2.*minrad;
+  while (r < maxrad && nlevels < MAXLEVELS) {
+    r *= 2.;
+    nlevels++;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   largest radius of all owned atoms
+   must be called on all procs
+------------------------------------------------------------------------- */
+
+double Neighbor::multi_maxrad_atoms()
+{
+  double *radius = atom->radius;
+  int nlocal = atom->nlocal;
+
+  double maxrad = 0.;
+  for (int i = 0; i < nlocal; i++)
+    if (radius[i] > maxrad) maxrad = radius[i];
+  MPI_Max_Scalar(maxrad,world);
+  return maxrad;
+}
+
+/* ----------------------------------------------------------------------
+   one stencil per level pair (ilevel,jlevel) for granular multi lists
+   stencil is in bins of jlevel and is searched by an atom of ilevel
+   stencil includes all bins within the pair cutoff of the two levels
+------------------------------------------------------------------------- */
+
+void Neighbor::stencil_gran_multi_3d_no_newton(NeighList *list,
+                                               int sx, int sy, int sz)
+{
+  int i,j,k,n,il,jl;
+  double cutsq;
+  int *s;
+
+  int nlevels = mlg->nlevels();
+  int **nstencil_multigran = list->nstencil_multigran;
+  int ***stencil_multigran = list->stencil_multigran;
+
+  for (il = 0; il < nlevels; il++) {
+    list->rmin_multigran[il] = mlg->rmin(il);
+    list->rmax_multigran[il] = mlg->rmax(il);
+  }
+
+  for (il = 0; il < nlevels; il++) {
+    for (jl = 0; jl < nlevels; jl++) {
+      mlg->stencil_extent(il,jl,sx,sy,sz);
+      cutsq = mlg->cutneigh(il,jl)*mlg->cutneigh(il,jl);
+      const int mbinx_j = mlg->mbinx(jl);
+      const int mbiny_j = mlg->mbiny(jl);
+      s = stencil_multigran[il][jl];
+      n = 0;
+      for (k = -sz; k <= sz; k++)
+        for (j = -sy; j <= sy; j++)
+          for (i = -sx; i <= sx; i++)
+            if (mlg->bin_distance(jl,i,j,k) < cutsq)
+              s[n++] = k*mbiny_j*mbinx_j + j*mbinx_j + i;
+      nstencil_multigran[il][jl] = n;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   granular particles
+   multi-level grid neighbor list construction, no Newton's 3rd law
+   atoms are binned into the bins of their size level
+   each owned atom i checks the bins of every level with the stencil of
+   its level pair, so small atoms only scan small bins
+   pair stored once if i,j are both owned and i < j
+   pair stored by me if j is ghost (also stored by proc owning j)
+------------------------------------------------------------------------- */
+
+void Neighbor::granular_multi_no_newton(NeighList *list)
+{
+  int i,j,k,m,n,nn=0,il,jl,ibin,d,ns;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
+  double radi,radsum,cutsq;
+  int *neighptr,*touchptr = NULL;
+  double *shearptr = NULL;
+  int *s,*head;
+
+  NeighList *listgranhistory;
+  int *npartner = NULL,**partner = NULL;
+  double **contacthistory = NULL;
+  int **firsttouch = NULL;
+  double **firstshear = NULL;
+  MyPage<int> *ipage_touch = NULL;
+  MyPage<double> *dpage_shear = NULL;
+  int dnum = 0;
+
+  // bin local & ghost atoms into the bins of their level
+
+  mlg->bin_atoms(bins,includegroup);
+
+  // loop over each atom, storing neighbors
+
+  double **x = atom->x;
+  double *radius = atom->radius;
+  int *tag = atom->tag;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  int *molecule = atom->molecule;
+  int nlocal = atom->nlocal;
+  if (includegroup) nlocal = atom->nfirst;
+
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+  int **nstencil_multigran = list->nstencil_multigran;
+  int ***stencil_multigran = list->stencil_multigran;
+  MyPage<int> *ipage = list->ipage;
+
+  int nlevels = mlg->nlevels();
+  int *atomlevel = mlg->atomlevel();
+
+  FixContactHistory *fix_history = list->fix_history;
+  if (fix_history) {
+    npartner = fix_history->npartner_;
+    partner = fix_history->partner_;
+    contacthistory = fix_history->contacthistory_;
+    listgranhistory = list->listgranhistory;
+    firsttouch = listgranhistory->firstneigh;
+    firstshear = listgranhistory->firstdouble;
+    ipage_touch = listgranhistory->ipage;
+    dpage_shear = listgranhistory->dpage;
+    dnum = listgranhistory->dnum;
+  }
+
+  int inum = 0;
+  ipage->reset();
+  if (fix_history) {
+    ipage_touch->reset();
+    dpage_shear->reset();
+  }
+
+  for (i = 0; i < nlocal; i++) {
+    n = 0;
+    neighptr = ipage->vget();
+    if (fix_history) {
+      nn = 0;
+      touchptr = ipage_touch->vget();
+      shearptr = dpage_shear->vget();
+    }
+
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    radi = radius[i];
+    il = atomlevel[i];
+
+    // loop over all levels, and over all atoms in the bins of that level
+    // within the stencil of the level pair, including own bin
+    // only store pair if i < j
+    // stores own/own pairs only once
+    // stores own/ghost pairs on both procs
+
+    for (jl = 0; jl < nlevels; jl++) {
+      ibin = mlg->coord2bin(x[i],jl);
+      head = mlg->binhead(jl);
+      s = stencil_multigran[il][jl];
+      ns = nstencil_multigran[il][jl];
+
+      for (k = 0; k < ns; k++) {
+        for (j = head[ibin+s[k]]; j >= 0; j = bins[j]) {
+          if (j <= i) continue;
+          if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+
+          delx = xtmp - x[j][0];
+          dely = ytmp - x[j][1];
+          delz = ztmp - x[j][2];
+          rsq = delx*delx + dely*dely + delz*delz;
+          radsum = (radi + radius[j]) * contactDistanceFactor;
+          cutsq = (radsum+skin) * (radsum+skin);
+
+          if (rsq <= cutsq) {
+            neighptr[n] = j;
+            if (fix_history) {
+              if (rsq < radsum*radsum) {
+                for (m = 0; m < npartner[i]; m++)
+                  if (partner[i][m] == tag[j]) break;
+                if (m < npartner[i]) {
+                  touchptr[n] = 1;
+                  for (d = 0; d < dnum; d++)
+                    shearptr[nn++] = contacthistory[i][m*dnum+d];
+                } else {
+                  touchptr[n] = 0;
+                  for (d = 0; d < dnum; d++)
+                    shearptr[nn++] = 0.0;
+                }
+              } else {
+                touchptr[n] = 0;
+                for (d = 0; d < dnum; d++)
+                  shearptr[nn++] = 0.0;
+              }
+            }
+
+            n++;
+          }
+        }
+      }
+    }
+
+    ilist[inum++] = i;
+    firstneigh[i] = neighptr;
+    numneigh[i] = n;
+    ipage->vgot(n);
+    if (ipage->status())
+      error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
+    if (fix_history) {
+      firsttouch[i] = touchptr;
+      firstshear[i] = shearptr;
+      ipage_touch->vgot(n);
+      dpage_shear->vgot(nn);
+    }
+  }
+
+  list->inum = inum;
+}
@@ -0,0 +1,358 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#include "neigh_multi_level_grid.h"
+#include "atom.h"
+#include "group.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+#define SMALL 1.0e-6
+
+/* ---------------------------------------------------------------------- */
+
+MultiLevelGrid::MultiLevelGrid(LAMMPS *lmp) : Pointers(lmp),
+  nlevels_(0),
+  maxlevels_(0),
+  rmin_(0.),
+  rmax_(NULL),
+  skin_(0.),
+  contactDistanceFactor_(1.),
+  bboxlo_(NULL),
+  bboxhi_(NULL),
+  nbinx_(NULL), nbiny_(NULL), nbinz_(NULL),
+  binsizex_(NULL), binsizey_(NULL), binsizez_(NULL),
+  bininvx_(NULL), bininvy_(NULL), bininvz_(NULL),
+  mbinxlo_(NULL), mbinylo_(NULL), mbinzlo_(NULL),
+  mbinx_(NULL), mbiny_(NULL), mbinz_(NULL),
+  mbins_(NULL),
+  maxhead_(NULL),
+  binhead_(NULL),
+  smax_(0),
+  atomlevel_(NULL),
+  maxatom_(0)
+{
+}
+
+/* ---------------------------------------------------------------------- */
+
+MultiLevelGrid::~MultiLevelGrid()
+{
+  for (int l = 0; l < maxlevels_; l++)
+    memory->destroy(binhead_[l]);
+  memory->sfree(binhead_);
+
+  memory->destroy(rmax_);
+  memory->destroy(nbinx_);
+  memory->destroy(nbiny_);
+  memory->destroy(nbinz_);
+  memory->destroy(binsizex_);
+  memory->destroy(binsizey_);
+  memory->destroy(binsizez_);
+  memory->destroy(bininvx_);
+  memory->destroy(bininvy_);
+  memory->destroy(bininvz_);
+  memory->destroy(mbinxlo_);
+  memory->destroy(mbinylo_);
+  memory->destroy(mbinzlo_);
+  memory->destroy(mbinx_);
+  memory->destroy(mbiny_);
+  memory->destroy(mbinz_);
+  memory->destroy(mbins_);
+  memory->destroy(maxhead_);
+  memory->destroy(atomlevel_);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void MultiLevelGrid::grow_levels(int n)
+{
+  if (n <= maxlevels_) return;
+
+  memory->grow(rmax_,n,"mlg:rmax");
+  memory->grow(nbinx_,n,"mlg:nbinx");
+  memory->grow(nbiny_,n,"mlg:nbiny");
+  memory->grow(nbinz_,n,"mlg:nbinz");
+  memory->grow(binsizex_,n,"mlg:binsizex");
+  memory->grow(binsizey_,n,"mlg:binsizey");
+  memory->grow(binsizez_,n,"mlg:binsizez");
+  memory->grow(bininvx_,n,"mlg:bininvx");
+  memory->grow(bininvy_,n,"mlg:bininvy");
+  memory->grow(bininvz_,n,"mlg:bininvz");
+  memory->grow(mbinxlo_,n,"mlg:mbinxlo");
+  memory->grow(mbinylo_,n,"mlg:mbinylo");
+  memory->grow(mbinzlo_,n,"mlg:mbinzlo");
+  memory->grow(mbinx_,n,"mlg:mbinx");
+  memory->grow(mbiny_,n,"mlg:mbiny");
+  memory->grow(mbinz_,n,"mlg:mbinz");
+  memory->grow(mbins_,n,"mlg:mbins");
+  memory->grow(maxhead_,n,"mlg:maxhead");
+  binhead_ = (int **) memory->srealloc(binhead_,n*sizeof(int *),"mlg:binhead");
+
+  for (int l = maxlevels_; l < n; l++) {
+    maxhead_[l] = 0;
+    binhead_[l] = NULL;
+  }
+  maxlevels_ = n;
+}
+
+/* ----------------------------------------------------------------------
+   setup levels and bins for each level
+   level l bin size is 1/2 of the neighbor cutoff between two particles
+   of the largest radius of level l
+   bins of each level cover my subdomain extended by the ghost cutoff,
+   same as Neighbor::setup_bins()
+------------------------------------------------------------------------- */
+
+void MultiLevelGrid::setup(double minrad, double maxrad, int nlevels,
+                           double skin, double contactDistanceFactor,
+                           const double *bboxlo, const double *bboxhi,
+                           const double *bsubboxlo, const double *bsubboxhi)
+{
+  if (nlevels < 1) error->all(FLERR,"Illegal number of multi-level grid levels");
+
+  grow_levels(nlevels);
+  nlevels_ = nlevels;
+  rmin_ = minrad;
+  skin_ = skin;
+  contactDistanceFactor_ = contactDistanceFactor;
+  bboxlo_ = bboxlo;
+  bboxhi_ = bboxhi;
+
+  // radius bounds double from level to level, last level ends at maxrad
+
+  double r = minrad;
+  for (int l = 0; l < nlevels_; l++) {
+    r *= 2.;
+    rmax_[l] = (l == nlevels_-1 || r > maxrad) ? maxrad : r;
+  }
+
+  double bbox[3];
+  bbox[0] = bboxhi[0] - bboxlo[0];
+  bbox[1] = bboxhi[1] - bboxlo[1];
+  bbox[2] = bboxhi[2] - bboxlo[2];
+
+  for (int l = 0; l < nlevels_; l++) {
+    double binsize_optimal = 0.5*cutneigh(l,l);
+    if (binsize_optimal == 0.0) binsize_optimal = bbox[0];
+    double binsizeinv = 1.0/binsize_optimal;
+
+    if (bbox[0]*binsizeinv > MAXSMALLINT || bbox[1]*binsizeinv > MAXSMALLINT ||
+        bbox[2]*binsizeinv > MAXSMALLINT)
+      error->all(FLERR,"Domain too large for neighbor bins");
+
+    nbinx_[l] = static_cast<int> (bbox[0]*binsizeinv);
+    nbiny_[l] = static_cast<int> (bbox[1]*binsizeinv);
+    nbinz_[l] = static_cast<int> (bbox[2]*binsizeinv);
+    if (nbinx_[l] == 0) nbinx_[l] = 1;
+    if (nbiny_[l] == 0) nbiny_[l] = 1;
+    if (nbinz_[l] == 0) nbinz_[l] = 1;
+
+    binsizex_[l] = bbox[0]/nbinx_[l];
+    binsizey_[l] = bbox[1]/nbiny_[l];
+    binsizez_[l] = bbox[2]/nbinz_[l];
+    bininvx_[l] = 1.0 / binsizex_[l];
+    bininvy_[l] = 1.0 / binsizey_[l];
+    bininvz_[l] = 1.0 / binsizez_[l];
+
+    // lowest and highest global bins my ghost atoms could be in
+    // extended by 1 to insure stencil extent is included
+
+    int mbinhi[3];
+    int *mbinlo[3] = {&mbinxlo_[l],&mbinylo_[l],&mbinzlo_[l]};
+    double bininv[3] = {bininvx_[l],bininvy_[l],bininvz_[l]};
+    for (int dim = 0; dim < 3; dim++) {
+      double coord = bsubboxlo[dim] - SMALL*bbox[dim];
+      *mbinlo[dim] = static_cast<int> ((coord-bboxlo[dim])*bininv[dim]);
+      if (coord < bboxlo[dim]) *mbinlo[dim] = *mbinlo[dim] - 1;
+      coord = bsubboxhi[dim] + SMALL*bbox[dim];
+      mbinhi[dim] = static_cast<int> ((coord-bboxlo[dim])*bininv[dim]);
+
+      *mbinlo[dim] = *mbinlo[dim] - 1;
+      mbinhi[dim] = mbinhi[dim] + 1;
+    }
+    mbinx_[l] = mbinhi[0] - mbinxlo_[l] + 1;
+    mbiny_[l] = mbinhi[1] - mbinylo_[l] + 1;
+    mbinz_[l] = mbinhi[2] - mbinzlo_[l] + 1;
+
+    bigint bbin = ((bigint) mbinx_[l]) * ((bigint) mbiny_[l]) * ((bigint) mbinz_[l]);
+    if (bbin > MAXSMALLINT) error->one(FLERR,"Too many neighbor bins");
+    mbins_[l] = bbin;
+    if (mbins_[l] > maxhead_[l]) {
+      maxhead_[l] = mbins_[l];
+      memory->destroy(binhead_[l]);
+      memory->create(binhead_[l],maxhead_[l],"mlg:binhead");
+    }
+  }
+
+  // size of largest stencil over all level pairs
+
+  smax_ = 0;
+  int sx,sy,sz;
+  for (int il = 0; il < nlevels_; il++)
+    for (int jl = 0; jl < nlevels_; jl++) {
+      stencil_extent(il,jl,sx,sy,sz);
+      smax_ = MAX(smax_,(2*sx+1) * (2*sy+1) * (2*sz+1));
+    }
+}
+
+/* ----------------------------------------------------------------------
+   max range of the stencil of level pair (ilevel,jlevel) in bins of jlevel
+------------------------------------------------------------------------- */
+
+void MultiLevelGrid::stencil_extent(int ilevel, int jlevel,
+                                    int &sx, int &sy, int &sz) const
+{
+  const double cut = cutneigh(ilevel,jlevel);
+
+  sx = static_cast<int> (cut*bininvx_[jlevel]);
+  if (sx*binsizex_[jlevel] < cut) sx++;
+  sy = static_cast<int> (cut*bininvy_[jlevel]);
+  if (sy*binsizey_[jlevel] < cut) sy++;
+  sz = static_cast<int> (cut*bininvz_[jlevel]);
+  if (sz*binsizez_[jlevel] < cut) sz++;
+}
+
+/* ----------------------------------------------------------------------
+   bin local & ghost atoms into the bins of their level
+   bins = per-atom ptr to next atom in bin, owned by Neighbor
+------------------------------------------------------------------------- */
+
+void MultiLevelGrid::bin_atoms(int *bins, int includegroup)
+{
+  int i,l,ibin;
+
+  for (l = 0; l < nlevels_; l++)
+    for (i = 0; i < mbins_[l]; i++) binhead_[l][i] = -1;
+
+  if (atom->nmax > maxatom_) {
+    maxatom_ = atom->nmax;
+    memory->destroy(atomlevel_);
+    memory->create(atomlevel_,maxatom_,"mlg:atomlevel");
+  }
+
+  // bin in reverse order so linked list will be in forward order
+  // also puts ghost atoms at end of list, which is necessary
+
+  double **x = atom->x;
+  double *radius = atom->radius;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
+
+  if (includegroup) {
+    int bitmask = group->bitmask[includegroup];
+    for (i = nall-1; i >= nlocal; i--) {
+      if (mask[i] & bitmask) {
+        l = atomlevel_[i] = level(radius[i]);
+        ibin = coord2bin(x[i],l);
+        bins[i] = binhead_[l][ibin];
+        binhead_[l][ibin] = i;
+      }
+    }
+    for (i = atom->nfirst-1; i >= 0; i--) {
+      l = atomlevel_[i] = level(radius[i]);
+      ibin = coord2bin(x[i],l);
+      bins[i] = binhead_[l][ibin];
+      binhead_[l][ibin] = i;
+    }
+
+  } else {
+    for (i = nall-1; i >= 0; i--) {
+      l = atomlevel_[i] = level(radius[i]);
+      ibin = coord2bin(x[i],l);
+      bins[i] = binhead_[l][ibin];
+      binhead_[l][ibin] = i;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   convert atom coords into local bin # of a level
+   same treatment of ghost atoms as Neighbor::coord2bin()
+------------------------------------------------------------------------- */
+
+int MultiLevelGrid::coord2bin(const double *x, int l) const
+{
+  int ix,iy,iz;
+
+  if (x[0] >= bboxhi_[0])
+    ix = static_cast<int> ((x[0]-bboxhi_[0])*bininvx_[l]) + nbinx_[l];
+  else if (x[0] >= bboxlo_[0]) {
+    ix = static_cast<int> ((x[0]-bboxlo_[0])*bininvx_[l]);
+    ix = MIN(ix,nbinx_[l]-1);
+  } else
+    ix = static_cast<int> ((x[0]-bboxlo_[0])*bininvx_[l]) - 1;
+
+  if (x[1] >= bboxhi_[1])
+    iy = static_cast<int> ((x[1]-bboxhi_[1])*bininvy_[l]) + nbiny_[l];
+  else if (x[1] >= bboxlo_[1]) {
+    iy = static_cast<int> ((x[1]-bboxlo_[1])*bininvy_[l]);
+    iy = MIN(iy,nbiny_[l]-1);
+  } else
+    iy = static_cast<int> ((x[1]-bboxlo_[1])*bininvy_[l]) - 1;
+
+  if (x[2] >= bboxhi_[2])
+    iz = static_cast<int> ((x[2]-bboxhi_[2])*bininvz_[l]) + nbinz_[l];
+  else if (x[2] >= bboxlo_[2]) {
+    iz = static_cast<int> ((x[2]-bboxlo_[2])*bininvz_[l]);
+    iz = MIN(iz,nbinz_[l]-1);
+  } else
+    iz = static_cast<int> ((x[2]-bboxlo_[2])*bininvz_[l]) - 1;
+
+  return (iz-mbinzlo_[l])*mbiny_[l]*mbinx_[l] +
+         (iy-mbinylo_[l])*mbinx_[l] + (ix-mbinxlo_[l]);
+}
+
+/* ----------------------------------------------------------------------
+   compute closest distance between central bin (0,0,0) and bin (i,j,k)
+   in the bins of a level
+------------------------------------------------------------------------- */
+
+double MultiLevelGrid::bin_distance(int l, int i, int j, int k) const
+{
+  double delx,dely,delz;
+
+  if (i > 0) delx = (i-1)*binsizex_[l];
+  else if (i == 0) delx = 0.0;
+  else delx = (i+1)*binsizex_[l];
+
+  if (j > 0) dely = (j-1)*binsizey_[l];
+  else if (j == 0) dely = 0.0;
+  else dely = (j+1)*binsizey_[l];
+
+  if (k > 0) delz = (k-1)*binsizez_[l];
+  else if (k == 0) delz = 0.0;
+  else delz = (k+1)*binsizez_[l];
+
+  return (delx*delx + dely*dely + delz*delz);
+}
+
+/* ---------------------------------------------------------------------- */
+
+bigint MultiLevelGrid::memory_usage()
+{
+  bigint bytes = 0;
+  for (int l = 0; l < maxlevels_; l++)
+    bytes += memory->usage(binhead_[l],maxhead_[l]);
+  bytes += memory->usage(atomlevel_,maxatom_);
+  return bytes;
+}
@@ -1 +1,125 @@
-#include "neigh_mlg_dummy.h"
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_NEIGHBOR_MULTI_LEVEL_GRID_H
+#define LMP_NEIGHBOR_MULTI_LEVEL_GRID_H
+
+#include "pointers.h"
+
+namespace LAMMPS_NS
+{
+
+/* ----------------------------------------------------------------------
+   hierarchical grid for granular neighbor lists with a wide size
+   distribution
+   particles are sorted into size classes (levels) by radius, each level
+   has its own bins sized for the largest radius of that level
+   level l holds radii in (rmax[l-1],rmax[l]], rmax doubles per level
+   a pair (i,j) is found by i searching the grid of j's level with the
+   stencil of the level pair, so fines never scan coarse-sized bins
+------------------------------------------------------------------------- */
+
+class MultiLevelGrid : protected Pointers
+{
+  friend class Neighbor;
+
+  public:
+
+    MultiLevelGrid(class LAMMPS *);
+    ~MultiLevelGrid();
+
+    // setup levels and per-level bins, must be called on all procs
+
+    void setup(double minrad, double maxrad, int nlevels,
+               double skin, double contactDistanceFactor,
+               const double *bboxlo, const double *bboxhi,
+               const double *bsubboxlo, const double *bsubboxhi);
+
+    // bin local & ghost atoms into the bins of their level
+
+    void bin_atoms(int *bins, int includegroup);
+
+    inline int level(double radius) const
+    {
+        int l = 0;
+        while(l < nlevels_-1 && radius > rmax_[l]) l++;
+        return l;
+    }
+
+    int coord2bin(const double *x, int level) const;
+    double bin_distance(int level, int i, int j, int k) const;
+    void stencil_extent(int ilevel, int jlevel, int &sx, int &sy, int &sz) const;
+    double cutneigh(int ilevel, int jlevel) const
+    { return (rmax_[ilevel]+rmax_[jlevel])*contactDistanceFactor_ + skin_; }
+
+    inline int nlevels() const
+    { return nlevels_; }
+
+    inline double rmin(int level) const
+    { return level == 0 ? rmin_ : rmax_[level-1]; }
+
+    inline double rmax(int level) const
+    { return rmax_[level]; }
+
+    inline int mbinx(int level) const
+    { return mbinx_[level]; }
+
+    inline int mbiny(int level) const
+    { return mbiny_[level]; }
+
+    inline int *binhead(int level) const
+    { return binhead_[level]; }
+
+    inline int *atomlevel() const
+    { return atomlevel_; }
+
+    // largest stencil over all level pairs
+
+    inline int smax() const
+    { return smax_; }
+
+    bigint memory_usage();
+
+  private:
+
+    void grow_levels(int n);
+
+    int nlevels_,maxlevels_;
+    double rmin_;
+    double *rmax_;                 // largest radius in each level
+    double skin_,contactDistanceFactor_;
+    const double *bboxlo_,*bboxhi_;
+
+    int *nbinx_,*nbiny_,*nbinz_;   // # of global bins per level
+    double *binsizex_,*binsizey_,*binsizez_;
+    double *bininvx_,*bininvy_,*bininvz_;
+    int *mbinxlo_,*mbinylo_,*mbinzlo_;
+    int *mbinx_,*mbiny_,*mbinz_;
+    int *mbins_;                   // # of local bins per level
+    int *maxhead_;
+    int **binhead_;                // ptr to 1st atom in each bin, per level
+    int smax_;
+
+    int *atomlevel_;               // level of each local and ghost atom
+    int maxatom_;
+};
+
+}
+
+#endif
@@ -44,6 +44,7 @@
 #include "fix.h"
 #include "compute.h"
 #include "update.h"
+#include "trace.h"
 #include "respa.h"
 #include "output.h"
 #include "citeme.h"
@@ -110,6 +111,14 @@ Neighbor::Neighbor(LAMMPS *lmp) : Pointers(lmp)
   maxhold = 0;
   xhold = NULL;
   rhold = NULL; //NP modified C.K.
+  nhold = 0;
+
+  // max displacement reported by integrator
+
+  fix_displacement = NULL;
+  displacement_step = -1;
+  displacement_local = displacement_all = 0.0;
+  displacement_pending = 0;
 
   // binning
 
@@ -179,6 +188,8 @@ Neighbor::Neighbor(LAMMPS *lmp) : Pointers(lmp)
 
 Neighbor::~Neighbor()
 {
+  wait_displacement();
+
   memory->destroy(cutneighsq);
   memory->destroy(cutneighghostsq);
   delete [] cuttype;
@@ -335,6 +346,25 @@ void Neighbor::init()
   if (restart_check || fix_check) must_check = 1;
   if (build_once) must_check = 0;
 
+  // integrator may report max displacement instead of check_distance() loop
+  // only if it is the only fix moving atoms and it integrates all atoms
+  // not with rRESPA, since initial_integrate() is invoked per inner level
+
+  wait_displacement();
+  fix_displacement = NULL;
+  displacement_step = -1;
+  if (dist_check && !build_once && !includegroup &&
+      modify->n_post_integrate == 0 && !strstr(update->integrate_style,"respa")) {
+    int ntime = 0;
+    Fix *fix_time = NULL;
+    for (i = 0; i < modify->nfix; i++)
+      if (modify->fix[i]->time_integrate) {
+        ntime++;
+        fix_time = modify->fix[i];
+      }
+    if (ntime == 1 && fix_time->igroup == 0) fix_displacement = fix_time;
+  }
+
   // set special_flag for 1-2, 1-3, 1-4 neighbors
   // flag[0] is not used, flag[1] = 1-2, flag[2] = 1-3, flag[3] = 1-4
   // flag = 0 if both LJ/Coulomb special values are 0.0
@@ -1406,6 +1436,16 @@ int Neighbor::check_distance()
     delta = sqrt(deltasq);
   }
 
+  // max displacement was reported by integrator, just complete reduction
+
+  if (displacement_step == update->ntimestep && atom->radvary_flag == 0) {
+    wait_displacement();
+    displacement_step = -1;
+    int flagall = (displacement_all > deltasq) ? 1 : 0;
+    if (flagall && ago == MAX(every,delay)) ndanger++;
+    return flagall;
+  }
+
   double **x = atom->x;
   double *radius = atom->radius; //NP modified C.K.
   int nlocal = atom->nlocal;
@@ -1455,6 +1495,64 @@ int Neighbor::check_distance()
   return flagall;
 }
 
+/* ----------------------------------------------------------------------
+   return 1 if fix is the integrator that should report the max displacement
+   of its atoms this step, i.e. if decide() will invoke check_distance()
+   same result on all procs, since report_displacement() is collective
+------------------------------------------------------------------------- */
+
+int Neighbor::displacement_due(Fix *fix)
+{
+  if (fix != fix_displacement || no_build || atom->radvary_flag || ago < 0)
+    return 0;
+  int next = ago + 1;
+  if (next < delay || next % every) return 0;
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   atom coords at last build, NULL if my atoms changed since then
+------------------------------------------------------------------------- */
+
+double **Neighbor::displacement_xhold()
+{
+  if (atom->nlocal != nhold) return NULL;
+  return xhold;
+}
+
+/* ----------------------------------------------------------------------
+   max squared displacement of my atoms since last build
+   start reduction over all procs, completed in check_distance()
+   so it overlaps with the remainder of the integration
+------------------------------------------------------------------------- */
+
+void Neighbor::report_displacement(double dispsq)
+{
+  wait_displacement();
+
+  if (atom->nlocal != nhold) dispsq = BIG;
+  displacement_local = dispsq;
+  displacement_step = update->ntimestep;
+
+  if (nprocs == 1) displacement_all = displacement_local;
+  else {
+    MPI_Iallreduce(&displacement_local,&displacement_all,1,MPI_DOUBLE,
+                   MPI_MAX,world,&displacement_request);
+    displacement_pending = 1;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Neighbor::wait_displacement()
+{
+  if (!displacement_pending) return;
+
+  MPI_Status status;
+  MPI_Wait(&displacement_request,&status);
+  displacement_pending = 0;
+}
+
 /* ----------------------------------------------------------------------
    build all perpetual neighbor lists every few timesteps
    pairwise & topology lists are created as needed
@@ -1465,12 +1563,18 @@ void Neighbor::build(int topoflag)
 {
   if (no_build) return;
 
+  TRACE_REGION("Neighbor::build");
+
   int i;
 
   ago = 0;
   ncalls++;
   lastcall = update->ntimestep;
 
+  // reduction started by integrator is not needed if rebuilding anyway
+
+  wait_displacement();
+
   // store current atom positions and box size if needed
 
   if (dist_check) {
@@ -1478,6 +1582,7 @@ void Neighbor::build(int topoflag)
     double *radius = atom->radius; //NP modified C.K.
     int nlocal = atom->nlocal;
     if (includegroup) nlocal = atom->nfirst;
+    nhold = nlocal;
     if (nlocal > maxhold) {
       maxhold = atom->nmax;
       memory->destroy(xhold);
@@ -1545,6 +1650,13 @@ void Neighbor::build(int topoflag)
     memory->create(bins,maxbin,"bins");
   }
 
+  //NP radii may grow during a run, setup levels and bins of the
+  //NP multi-level grid again if an atom outgrew the largest level
+
+  if (mlg && atom->radvary_flag &&
+      multi_maxrad_atoms() > mlg->rmax(mlg->nlevels()-1))
+    setup_bins();
+
   // check that neighbor list with special bond flags will not overflow
 
   if (atom->nlocal+atom->nghost > NEIGHMASK)
@@ -1794,6 +1906,24 @@ void Neighbor::setup_bins()
   if (dimension == 2) sz = 0;
   smax = (2*sx+1) * (2*sy+1) * (2*sz+1);
 
+  //NP multi-level grid for granular multi lists
+  //NP levels and their bins are setup here, stencils must fit all level pairs
+
+  int gran_multi = 0;
+  for (int i = 0; i < nslist; i++)
+    if (stencil_create[slist[i]] == &Neighbor::stencil_gran_multi_3d_no_newton)
+      gran_multi = 1;
+
+  if (gran_multi) {
+    double maxrad,minrad;
+    int nlevels;
+    multi_levels(maxrad,minrad,nlevels);
+    if (!mlg) mlg = new MultiLevelGrid(lmp);
+    mlg->setup(minrad,maxrad,nlevels,skin,contactDistanceFactor,
+               bboxlo,bboxhi,bsubboxlo,bsubboxhi);
+    smax = MAX(smax,mlg->smax());
+  }
+
   // create stencils for pairwise neighbor lists
   // only done for lists with stencilflag and buildflag set
 
@@ -2174,6 +2304,7 @@ bigint Neighbor::memory_usage()
     bytes += memory->usage(bins,maxbin);
     bytes += memory->usage(binhead,maxhead);
   }
+  if (mlg) bytes += mlg->memory_usage();
 
   for (int i = 0; i < nlist; i++) bytes += lists[i]->memory_usage();
 
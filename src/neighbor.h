@@ -115,6 +115,14 @@ class Neighbor : protected Pointers {
   //NP modified C.K.
   void multi_levels(double &, double &, int &);
   int multi_levels();
+  double multi_maxrad_atoms();
+
+  // max displacement since last build reported by the time integrator
+  // saves the pass over all atoms in check_distance()
+
+  int displacement_due(class Fix *);
+  double **displacement_xhold();
+  void report_displacement(double);
 
  protected:
   int me,nprocs;
@@ -134,6 +142,15 @@ class Neighbor : protected Pointers {
   double *cuttypesq;               // cuttype squared
 
   double triggersq;                // trigger = build when atom moves this dist
+
+  class Fix *fix_displacement;     // integrator reporting max displacement
+  int nhold;                       // # of atoms stored in xhold
+  bigint displacement_step;        // step of last reported displacement
+  double displacement_local;       // my max squared displacement
+  double displacement_all;         // max squared displacement of all procs
+  MPI_Request displacement_request;
+  int displacement_pending;        // 1 if reduction is in flight
+  void wait_displacement();
   int cluster_check;               // 1 if check bond/angle/etc satisfies minimg
 
   double **xhold;                      // atom coords at last neighbor build
@@ -25,6 +25,7 @@
 #include "group.h"
 #include "domain.h"
 #include "thermo.h"
+#include "trace.h"
 #include "modify.h"
 #include "compute.h"
 #include "force.h"
@@ -288,6 +289,8 @@ void Output::setup(int memflag)
 
 void Output::write(bigint ntimestep)
 {
+  TRACE_REGION("Output::write");
+
   // next_dump does not force output on last step of run
   // wrap dumps that invoke computes or eval of variable with clear/add
   // download data from GPU if necessary
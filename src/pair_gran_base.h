@@ -37,6 +37,7 @@
 #include "pair_gran.h"
 #include "neighbor.h"
 #include "neigh_list.h"
+#include "comm.h"
 #include "fix_contact_property_atom.h"
 #include "os_specific.h"
 
@@ -188,6 +189,9 @@ public:
     const bool store_contact_forces = pg->storeContactForces();
     const int freeze_group_bit = pg->freeze_group_bit();
 
+    // atoms not moved this step if fix sleep is used, NULL otherwise
+    const int * const fresh = comm->fresh_atoms();
+
     // clear data, just to be safe
     memset((void*)aligned_cdata, 0, sizeof(CollisionData));
     memset((void*)aligned_i_forces, 0, sizeof(ForceData));
@@ -226,10 +230,16 @@ public:
 #else
       cdata.radi = radi;
 #endif
+      const bool i_asleep = fresh && !fresh[i];
 
       for (int jj = 0; jj < jnum; jj++) {
         const int j = jlist[jj] & NEIGHMASK;
 
+        // contact of two sleeping atoms does not change, skip it
+        // and leave its contact history untouched
+
+        if (i_asleep && !fresh[j]) continue;
+
         const double delx = xtmp - x[j][0];
         const double dely = ytmp - x[j][1];
         const double delz = ztmp - x[j][2];
@@ -47,6 +47,7 @@ andreas.aigner@jku.at
 #include "sph_kernels.h"
 #include "fix_property_atom.h"
 #include "fix_property_global.h"
+#include "fix_sph_density_summation.h"
 #include "timer.h"
 
 using namespace LAMMPS_NS;
@@ -69,6 +70,7 @@ PairSph::PairSph(LAMMPS *lmp) : Pair(lmp)
     slComType = NULL;
 
     fix_fgradP_ = NULL;
+    fixDensitySum_ = NULL;
 
     mass_type = atom->avec->mass_type; // get flag for mass per type
 
@@ -226,6 +228,7 @@ void PairSph::init_style()
   }
   if (ifix_d == -1) error->all(FLERR,"Pair sph requires a fix sph/density");
   if (ifix_p == -1) error->all(FLERR,"Pair sph requires a fix sph/pressure");
+  fixDensitySum_ = dynamic_cast<FixSPHDensitySum*>(modify->fix[ifix_d]);
 
   // init individual for mass_type 0/1
   // mass_type = 1 ... get fppaSlType, the perAtomType smoothing length
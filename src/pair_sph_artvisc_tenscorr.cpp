@@ -32,6 +32,7 @@ andreas.aigner@jku.at
 #include "pair_sph_artvisc_tenscorr.h"
 #include "fix_property_global.h"
 #include "fix_property_atom.h"
+#include "fix_sph_density_summation.h"
 #include "atom.h"
 #include "comm.h"
 #include "force.h"
@@ -253,8 +254,33 @@ void PairSphArtviscTenscorr::allocate_properties(int size)
 
 void PairSphArtviscTenscorr::compute(int eflag, int vflag)
 {
-  if (mass_type) compute_eval<1>(eflag,vflag);
-  else compute_eval<0>(eflag,vflag);
+  // select the kernel once, so the pair loop is specialized for it
+
+  if (0) return;
+  #define SPH_KERNEL_CLASS
+  #define SPHKernel(kernel_id_,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+  else if (kernel_id == kernel_id_) compute_kernel<kernel_id_>(eflag,vflag);
+  #include "style_sph_kernel.h"
+  #undef SPH_KERNEL_CLASS
+  #undef SPHKernel
+  else error->all(FLERR,"Pair sph/artVisc/tensCorr: unknown sph kernel");
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int KERNEL>
+void PairSphArtviscTenscorr::compute_kernel(int eflag, int vflag)
+{
+  // reuse kernel values of fix sph/density/summation if it
+  // ran on this step with the same neighbor list and kernel
+
+  if (fixDensitySum_ && fixDensitySum_->kernel_cache_valid(list,kernel_id)) {
+    if (mass_type) compute_eval<1,1,KERNEL>(eflag,vflag);
+    else compute_eval<0,1,KERNEL>(eflag,vflag);
+  } else {
+    if (mass_type) compute_eval<1,0,KERNEL>(eflag,vflag);
+    else compute_eval<0,0,KERNEL>(eflag,vflag);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -317,9 +343,11 @@ void PairSphArtviscTenscorr::read_restart_settings(FILE *fp)
    template compute
 ------------------------------------------------------------------------- */
 
-template <int MASSFLAG>
+template <int MASSFLAG, int CACHEFLAG, int KERNEL>
 void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
 {
+  typedef SPH_KERNEL_NS::SPHKernelT<KERNEL> Kernel;
+
   double sli,slCom,imass,jmass;
   double artVisc,fAB4,rAB;
   double rA,rB;
@@ -350,6 +378,9 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
   int * const numneigh = list->numneigh;
   int ** const firstneigh = list->firstneigh;
 
+  const int * const cacheOffset = CACHEFLAG ? fixDensitySum_->cache_offset() : NULL;
+  const double * const kernelCache = CACHEFLAG ? fixDensitySum_->kernel_cache() : NULL;
+
   // loop over neighbors of my atoms
   // depend on mass_type
 
@@ -368,6 +399,7 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
     const double ztmp = x[i][2];
     int * const jlist = firstneigh[i];
     const int jnum = numneigh[i];
+    const double * const kc = CACHEFLAG ? &kernelCache[3*cacheOffset[ii]] : NULL;
 
     const double rhoi = rho[i];
     const double pi = p[i];
@@ -392,12 +424,16 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
       const double delz = ztmp - x[j][2];
       const double rsq = delx*delx + dely*dely + delz*delz;
 
-      if (!MASSFLAG) {
+      if (!MASSFLAG && !CACHEFLAG) {
         const double radj = radius[j];
         rcom = interpDist(radi,radj);
       }
 
-      if ((MASSFLAG && rsq < cutsq[itype][jtype]) || (!MASSFLAG && rsq < rcom*rcom)) {
+      // cached r < 0 if outside the kernel support
+
+      if ((CACHEFLAG && kc[3*jj] >= 0.) ||
+          (!CACHEFLAG && MASSFLAG && rsq < cutsq[itype][jtype]) ||
+          (!CACHEFLAG && !MASSFLAG && rsq < rcom*rcom)) {
 
         if (MASSFLAG) {
           jmass = mass[jtype];
@@ -414,7 +450,7 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
         //cut = slCom*SPH_KERNEL_NS::sph_kernel_cut(kernel_id);
 
         // get distance and normalized distance
-        const double r = sqrt(rsq);
+        const double r = CACHEFLAG ? kc[3*jj] : sqrt(rsq);
         if (r == 0.) {
           printf("Particle %i and %i are at same position (%f, %f, %f)",i,j,xtmp,ytmp,ztmp);
           error->one(FLERR,"Zero distance between SPH particles!");
@@ -423,7 +459,7 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
         const double s = r * slComInv;
 
         // calculate value for magnitude of grad W
-        const double gradWmag = SPH_KERNEL_NS::sph_kernel_der(kernel_id,s,slCom,slComInv);
+        const double gradWmag = CACHEFLAG ? kc[3*jj+2] : Kernel::kernel_der(s,slCom,slComInv);
 
         // artificial viscosity
         artVisc = 0.0;
@@ -464,11 +500,12 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
           } else {
             // assumption that deltaP = sl / 1.2
             const double deltaPOne = slCom/1.2;
-            wDeltaPinv = 1./SPH_KERNEL_NS::sph_kernel(kernel_id,deltaPOne * slComInv,slCom,slComInv);
+            wDeltaPinv = 1./Kernel::kernel(deltaPOne * slComInv,slCom,slComInv);
           }
 
           //TODO: Is fAB4 in this form ok?!
-          const double fAB =  SPH_KERNEL_NS::sph_kernel(kernel_id,s,slCom,slComInv) * wDeltaPinv;
+          const double W = CACHEFLAG ? kc[3*jj+1] : Kernel::kernel(s,slCom,slComInv);
+          const double fAB = W * wDeltaPinv;
           const double fAB2 = fAB * fAB;
           fAB4 = fAB2 * fAB2;
         }
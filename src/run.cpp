@@ -24,6 +24,7 @@
 #include "timer.h"
 #include "error.h"
 #include "force.h"
+#include "trace.h"
 
 using namespace LAMMPS_NS;
 
@@ -150,6 +151,7 @@ void Run::command(int narg, char **arg)
   // if post, do full Finish, else just print time
 
   update->whichflag = 1;
+  TRACE_INIT(world);
 
   if (nevery == 0) {
     update->nsteps = nsteps;
@@ -177,6 +179,7 @@ void Run::command(int narg, char **arg)
 
     Finish finish(lmp);
     finish.end(postflag);
+    TRACE_WRITE(world);
 
   // perform multiple runs optionally interleaved with invocation command(s)
   // use start/stop to set begin/end step
@@ -216,6 +219,7 @@ void Run::command(int narg, char **arg)
       Finish finish(lmp);
       if (postflag || nleft <= nsteps) finish.end(1);
       else finish.end(0);
+      TRACE_WRITE(world);
 
       // wrap command invocation with clearstep/addstep
       // since a command may invoke computes via variables
@@ -38,6 +38,31 @@ namespace SPH_KERNEL_NS {
   inline double sph_kernel_cut(int id);
 }
 
+/* ----------------------------------------------------------------------
+   compile-time kernel selection, one specialization per kernel id
+   lets loops be templated on the kernel instead of calling sph_kernel(id,...)
+   for every pair
+------------------------------------------------------------------------- */
+
+namespace SPH_KERNEL_NS {
+
+  template <int ID> struct SPHKernelT;
+
+  #define SPH_KERNEL_CLASS
+  #define SPHKernel(kernel_id,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+  template <> struct SPHKernelT<kernel_id> { \
+    static inline double kernel(double s,double h,double hinv) \
+    { return SPH_KERNEL_NS::SPHKernelCalculation(s,h,hinv); } \
+    static inline double kernel_der(double s,double h,double hinv) \
+    { return SPH_KERNEL_NS::SPHKernelCalculationDer(s,h,hinv); } \
+    static inline double kernel_cut() \
+    { return SPH_KERNEL_NS::SPHKernelCalculationCut(); } \
+  };
+  #include "style_sph_kernel.h"
+  #undef SPH_KERNEL_CLASS
+  #undef SPHKernel
+}
+
 /* ---------------------------------------------------------------------- */
 
 inline int SPH_KERNEL_NS::sph_kernels_unique_id()
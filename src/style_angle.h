@@ -0,0 +1 @@
+#include "angle_hybrid.h"
@@ -0,0 +1,3 @@
+#include "cfd_datacoupling_file.h"
+#include "cfd_datacoupling_mpi.h"
+#include "cfd_datacoupling_one2one.h"
@@ -0,0 +1,23 @@
+#include "balance.h"
+#include "change_box.h"
+#include "coarsegraining.h"
+#include "create_atoms.h"
+#include "create_box.h"
+#include "create_multisphere_clump.h"
+#include "delete_atoms.h"
+#include "delete_bonds.h"
+#include "displace_atoms.h"
+#include "extract_surface.h"
+#include "extrude_surface.h"
+#include "minimize.h"
+#include "read_data.h"
+#include "read_dump.h"
+#include "read_restart.h"
+#include "replicate.h"
+#include "rerun.h"
+#include "run.h"
+#include "set.h"
+#include "velocity.h"
+#include "write_data.h"
+#include "write_dump.h"
+#include "write_restart.h"
@@ -0,0 +1 @@
+#include "dihedral_hybrid.h"
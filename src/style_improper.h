@@ -0,0 +1 @@
+#include "improper_hybrid.h"
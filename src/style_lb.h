@@ -0,0 +1 @@
+#include "lbalance_simple.h"
@@ -0,0 +1,9 @@
+#include "normal_model_hertz.h"
+#include "normal_model_hertz_break.h"
+#include "normal_model_hertz_stiffness.h"
+#include "normal_model_hooke.h"
+#include "normal_model_hooke_break.h"
+#include "normal_model_hooke_hysteresis.h"
+#include "normal_model_hooke_stiffness.h"
+#include "normal_model_hooke_stiffness_collheat.h"
+#include "normal_model_jkr.h"
@@ -0,0 +1,3 @@
+#include "tangential_model_history.h"
+#include "tangential_model_incremental_history.h"
+#include "tangential_model_no_history.h"
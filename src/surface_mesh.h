@@ -38,6 +38,9 @@
 #include "mpi_liggghts.h"
 #include "comm.h"
 #include <cmath>
+#include <vector>
+#include <utility>
+#include <algorithm>
 #include "math_extra_liggghts.h"
 
 #define EPSILON_CURVATURE 0.00001
@@ -471,11 +471,40 @@ void SurfaceMesh<NUM_NODES,NUM_NEIGH_MAX>::buildNeighbours()
         hasNonCoplanarSharedNode_.set(i,f);
     }
 
-    // build neigh topology and edge activity, ~n*n/2
+    // candidate pairs for sharing an edge, ~n log n
+    //NP elements can only share nodes if their bounding spheres overlap,
+    //NP so sweep over elements sorted by lower x bound of bounding sphere
+    //NP and only pair elements whose x ranges overlap
+    //NP precision is added so no pair is lost due to round-off
+
+    std::vector<std::pair<double,int> > xlo(nall);
     for(int i = 0; i < nall; i++)
+        xlo[i] = std::make_pair(this->center_(i)[0]-this->rBound_(i),i);
+    std::sort(xlo.begin(),xlo.end());
+
+    std::vector<std::pair<int,int> > pairs;
+    for(int k = 0; k < nall; k++)
     {
-      for(int j = i+1; j < nall; j++)
-      {
+        const int i = xlo[k].second;
+        const double xhi = this->center_(i)[0]+this->rBound_(i)+this->precision();
+        for(int l = k+1; l < nall && xlo[l].first <= xhi; l++)
+        {
+            const int j = xlo[l].second;
+            pairs.push_back(std::make_pair(MathExtraLiggghts::min(i,j),MathExtraLiggghts::max(i,j)));
+        }
+    }
+
+    // process pairs in the same order as a loop over all i < j
+    // so neighbor lists do not depend on the sweep
+    std::sort(pairs.begin(),pairs.end());
+
+    // build neigh topology and edge activity
+    const int npairs = pairs.size();
+    for(int k = 0; k < npairs; k++)
+    {
+        const int i = pairs[k].first;
+        const int j = pairs[k].second;
+
         //NP continue of do not share any node so can not share an edge
         int iEdge(0), jEdge(0);
 
@@ -483,7 +512,6 @@ void SurfaceMesh<NUM_NODES,NUM_NEIGH_MAX>::buildNeighbours()
         //NP so for duplicate elements, only 1 edge is handled here!!
         if(shareEdge(i,j,iEdge,jEdge))
           handleSharedEdge(i,iEdge,j,jEdge, areCoplanar(TrackingMesh<NUM_NODES>::id(i),TrackingMesh<NUM_NODES>::id(j)));
-      }
     }
 
     int *idListVisited = new int[nall];
@@ -315,17 +315,17 @@ void Thermo::compute(int flag)
   for (i = 0; i < ncompute; i++)
     if (compute_which[i] == SCALAR) {
       if (!(computes[i]->invoked_flag & INVOKED_SCALAR)) {
-        computes[i]->compute_scalar();
+        computes[i]->compute_scalar_timed();
         computes[i]->invoked_flag |= INVOKED_SCALAR;
       }
     } else if (compute_which[i] == VECTOR) {
       if (!(computes[i]->invoked_flag & INVOKED_VECTOR)) {
-        computes[i]->compute_vector();
+        computes[i]->compute_vector_timed();
         computes[i]->invoked_flag |= INVOKED_VECTOR;
       }
     } else if (compute_which[i] == ARRAY) {
       if (!(computes[i]->invoked_flag & INVOKED_ARRAY)) {
-        computes[i]->compute_array();
+        computes[i]->compute_array_timed();
         computes[i]->invoked_flag |= INVOKED_ARRAY;
       }
     }
@@ -1069,7 +1069,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(temperature->invoked_flag & INVOKED_SCALAR)) {
-      temperature->compute_scalar();
+      temperature->compute_scalar_timed();
       temperature->invoked_flag |= INVOKED_SCALAR;
     }
     compute_temp();
@@ -1083,7 +1083,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_SCALAR)) {
-      pressure->compute_scalar();
+      pressure->compute_scalar_timed();
       pressure->invoked_flag |= INVOKED_SCALAR;
     }
     compute_press();
@@ -1097,7 +1097,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pe->invoked_flag & INVOKED_SCALAR)) {
-      pe->compute_scalar();
+      pe->compute_scalar_timed();
       pe->invoked_flag |= INVOKED_SCALAR;
     }
     compute_pe();
@@ -1111,7 +1111,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(temperature->invoked_flag & INVOKED_SCALAR)) {
-      temperature->compute_scalar();
+      temperature->compute_scalar_timed();
       temperature->invoked_flag |= INVOKED_SCALAR;
     }
     compute_ke();
@@ -1125,7 +1125,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pe->invoked_flag & INVOKED_SCALAR)) {
-      pe->compute_scalar();
+      pe->compute_scalar_timed();
       pe->invoked_flag |= INVOKED_SCALAR;
     }
     if (!temperature)
@@ -1136,7 +1136,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(temperature->invoked_flag & INVOKED_SCALAR)) {
-      temperature->compute_scalar();
+      temperature->compute_scalar_timed();
       temperature->invoked_flag |= INVOKED_SCALAR;
     }
     compute_etotal();
@@ -1150,7 +1150,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pe->invoked_flag & INVOKED_SCALAR)) {
-      pe->compute_scalar();
+      pe->compute_scalar_timed();
       pe->invoked_flag |= INVOKED_SCALAR;
     }
     if (!temperature)
@@ -1161,7 +1161,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(temperature->invoked_flag & INVOKED_SCALAR)) {
-      temperature->compute_scalar();
+      temperature->compute_scalar_timed();
       temperature->invoked_flag |= INVOKED_SCALAR;
     }
     if (!pressure)
@@ -1172,7 +1172,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_SCALAR)) {
-      pressure->compute_scalar();
+      pressure->compute_scalar_timed();
       pressure->invoked_flag |= INVOKED_SCALAR;
     }
     compute_enthalpy();
@@ -1300,7 +1300,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->compute_vector_timed();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pxx();
@@ -1314,7 +1314,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->compute_vector_timed();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pyy();
@@ -1328,7 +1328,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->compute_vector_timed();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pzz();
@@ -1342,7 +1342,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->compute_vector_timed();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pxy();
@@ -1356,7 +1356,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->compute_vector_timed();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pxz();
@@ -1370,7 +1370,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->compute_vector_timed();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pyz();
@@ -38,9 +38,7 @@ void Timer::init()
 {
   for (int i = 0; i < TIME_N; i++) array[i] = 0.0;
 
-  if(modify->timing) {
-    for (int i = 0; i < modify->nfix; i++) modify->fix[i]->reset_time_recording();
-  }
+  if(modify->timing) modify->reset_timing();
 }
 
 /* ---------------------------------------------------------------------- */
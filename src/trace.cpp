@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifdef LAMMPS_TRACE
+
+#include <mpi.h>
+#include <stdio.h>
+#include "trace.h"
+
+using namespace LAMMPS_NS;
+
+Trace::Thread *Trace::threads = NULL;
+int Trace::nthreads = 0;
+double Trace::time0 = 0.0;
+
+/* ----------------------------------------------------------------------
+   allocate one ring buffer per thread on first call
+   the buffers are kept until the process exits, so events of
+   consecutive runs end up in the same buffer
+   called before each run, outside of threaded regions
+   the barrier aligns the time origin of all procs in the trace files
+------------------------------------------------------------------------- */
+
+void Trace::init(MPI_Comm world)
+{
+  if (!threads) {
+#if defined(_OPENMP)
+    nthreads = omp_get_max_threads();
+#else
+    nthreads = 1;
+#endif
+    threads = new Thread[nthreads];
+    for (int i = 0; i < nthreads; i++) {
+      threads[i].events = new Event[NEVENT];
+      threads[i].next = threads[i].nevent = 0;
+      threads[i].depth = 0;
+    }
+    MPI_Barrier(world);
+    time0 = MPI_Wtime();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   write events of all threads of this proc to trace.<proc>.json
+   as Chrome trace "complete" events, times in microseconds
+------------------------------------------------------------------------- */
+
+void Trace::write(MPI_Comm world)
+{
+  if (!threads) return;
+
+  int me;
+  MPI_Comm_rank(world,&me);
+
+  char fname[64];
+  sprintf(fname,"trace.%d.json",me);
+  FILE *fp = fopen(fname,"w");
+  if (!fp) return;
+
+  fprintf(fp,"{\"traceEvents\":[\n");
+  fprintf(fp,"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+          "\"args\":{\"name\":\"proc %d\"}}",me,me);
+
+  for (int t = 0; t < nthreads; t++) {
+    Thread &thr = threads[t];
+    int first = (thr.next - thr.nevent + NEVENT) % NEVENT;
+    for (int i = 0; i < thr.nevent; i++) {
+      const Event &ev = thr.events[(first + i) % NEVENT];
+      fprintf(fp,",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,"
+              "\"ts\":%.3f,\"dur\":%.3f}",ev.name,me,t,
+              (ev.start-time0)*1.0e6,(ev.stop-ev.start)*1.0e6);
+    }
+  }
+
+  fprintf(fp,"\n],\"displayTimeUnit\":\"ms\"}\n");
+  fclose(fp);
+}
+
+#endif
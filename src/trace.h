@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+   LIGGGHTS - LAMMPS Improved for General Granular and Granular Heat
+   Transfer Simulations
+
+   LIGGGHTS is part of the CFDEMproject
+   www.liggghts.com | www.cfdem.com
+
+   Copyright 2012-     DCS Computing GmbH, Linz
+
+   LIGGGHTS is based on LAMMPS
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_TRACE_H
+#define LMP_TRACE_H
+
+/* ----------------------------------------------------------------------
+   event tracing of code regions, enabled by compiling with -DLAMMPS_TRACE
+
+   TRACE_REGION("name") records the time from this statement to the end
+   of the enclosing scope as one event of the calling thread
+   TRACE_BEGIN("name") and TRACE_END() do the same for a region that
+   is not a scope, regions may be nested
+   the name has to be a string literal, since only the pointer is stored
+
+   each thread records into its own ring buffer, so only the latest
+   events are kept if a run records more than Trace::NEVENT events
+   Trace::write() dumps the events in the Chrome trace event format,
+   which can be viewed with chrome://tracing or ui.perfetto.dev
+
+   without -DLAMMPS_TRACE all macros compile to nothing
+------------------------------------------------------------------------- */
+
+#ifdef LAMMPS_TRACE
+
+#include <mpi.h>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace LAMMPS_NS {
+
+class Trace {
+ public:
+  static const int NEVENT = 1 << 16;   // size of ring buffer per thread
+  static const int NDEPTH = 32;        // max nesting depth of regions
+
+  static void init(MPI_Comm);
+  static void write(MPI_Comm);
+
+  static inline void begin(const char *name)
+  {
+    Thread *thr = thread();
+    if (!thr) return;
+    if (thr->depth < NDEPTH) {
+      thr->stack_name[thr->depth] = name;
+      thr->stack_start[thr->depth] = MPI_Wtime();
+    }
+    thr->depth++;
+  }
+
+  static inline void end()
+  {
+    Thread *thr = thread();
+    if (!thr || thr->depth == 0) return;
+    thr->depth--;
+    if (thr->depth >= NDEPTH) return;
+
+    Event &ev = thr->events[thr->next];
+    ev.name = thr->stack_name[thr->depth];
+    ev.start = thr->stack_start[thr->depth];
+    ev.stop = MPI_Wtime();
+    thr->next = (thr->next + 1) % NEVENT;
+    if (thr->nevent < NEVENT) thr->nevent++;
+  }
+
+ private:
+  struct Event {
+    const char *name;
+    double start,stop;
+  };
+
+  struct Thread {
+    Event *events;
+    int next,nevent;
+    int depth;
+    const char *stack_name[NDEPTH];
+    double stack_start[NDEPTH];
+  };
+
+  static Thread *threads;    // one ring buffer per thread
+  static int nthreads;
+  static double time0;       // MPI_Wtime() at init, after a barrier
+
+  static inline Thread *thread()
+  {
+#if defined(_OPENMP)
+    const int tid = omp_get_thread_num();
+#else
+    const int tid = 0;
+#endif
+    if (tid >= nthreads) return 0;
+    return &threads[tid];
+  }
+};
+
+class TraceRegion {
+ public:
+  TraceRegion(const char *name) { Trace::begin(name); }
+  ~TraceRegion() { Trace::end(); }
+};
+
+}
+
+#define TRACE_CONCAT_(a,b) a ## b
+#define TRACE_CONCAT(a,b) TRACE_CONCAT_(a,b)
+#define TRACE_REGION(name) \
+  LAMMPS_NS::TraceRegion TRACE_CONCAT(trace_region_,__LINE__)(name)
+#define TRACE_BEGIN(name) LAMMPS_NS::Trace::begin(name)
+#define TRACE_END() LAMMPS_NS::Trace::end()
+#define TRACE_INIT(comm) LAMMPS_NS::Trace::init(comm)
+#define TRACE_WRITE(comm) LAMMPS_NS::Trace::write(comm)
+
+#else
+
+#define TRACE_REGION(name)
+#define TRACE_BEGIN(name)
+#define TRACE_END()
+#define TRACE_INIT(comm)
+#define TRACE_WRITE(comm)
+
+#endif
+
+#endif
@@ -939,7 +939,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-            compute->compute_scalar();
+            compute->compute_scalar_timed();
             compute->invoked_flag |= INVOKED_SCALAR;
           }
 
@@ -964,7 +964,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-            compute->compute_vector();
+            compute->compute_vector_timed();
             compute->invoked_flag |= INVOKED_VECTOR;
           }
 
@@ -992,7 +992,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-            compute->compute_array();
+            compute->compute_array_timed();
             compute->invoked_flag |= INVOKED_ARRAY;
           }
 
@@ -1015,7 +1015,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-            compute->compute_peratom();
+            compute->compute_peratom_timed();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -1035,7 +1035,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-            compute->compute_peratom();
+            compute->compute_peratom_timed();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -1061,7 +1061,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-            compute->compute_peratom();
+            compute->compute_peratom_timed();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -1089,7 +1089,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-            compute->compute_peratom();
+            compute->compute_peratom_timed();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -3156,7 +3156,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
             error->all(FLERR,
                        "Compute used in variable between runs is not current");
         } else if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->compute_vector_timed();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         nvec = compute->size_vector;
@@ -3170,7 +3170,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
             error->all(FLERR,
                        "Compute used in variable between runs is not current");
         } else if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-          compute->compute_array();
+          compute->compute_array_timed();
           compute->invoked_flag |= INVOKED_ARRAY;
         }
         nvec = compute->size_array_rows;
@@ -40,6 +40,7 @@
 #include "compute.h"
 #include "fix.h"
 #include "timer.h"
+#include "trace.h"
 #include "memory.h"
 #include "error.h"
 
@@ -227,19 +228,24 @@ void Verlet::run(int n)
   int n_pre_force = modify->n_pre_force;
   int n_post_force = modify->n_post_force;
   int n_end_of_step = modify->n_end_of_step;
+  int trace_every = modify->trace_every;
 
   if (atom->sortfreq > 0) sortflag = 1;
   else sortflag = 0;
 
   for (int i = 0; i < n; i++) {
 
+    TRACE_REGION("Verlet::step");
+
     ntimestep = ++update->ntimestep;
     ev_set(ntimestep);
 
     // initial time integration
 
+    TRACE_BEGIN("Modify::initial_integrate");
     modify->initial_integrate(vflag);
     if (n_post_integrate) modify->post_integrate();
+    TRACE_END();
 
     // regular communication vs neighbor list rebuild
 
@@ -250,7 +256,9 @@ void Verlet::run(int n)
       comm->forward_comm();
       timer->stamp(TIME_COMM);
     } else {
+      TRACE_BEGIN("Modify::pre_exchange");
       if (n_pre_exchange) modify->pre_exchange();
+      TRACE_END();
       if (triclinic) domain->x2lamda(atom->nlocal);
       domain->pbc();
       if (domain->box_change) {
@@ -273,7 +281,9 @@ void Verlet::run(int n)
       comm->borders();
       if (triclinic) domain->lamda2x(atom->nlocal+atom->nghost);
       timer->stamp(TIME_COMM);
+      TRACE_BEGIN("Modify::pre_neighbor");
       if (n_pre_neighbor) modify->pre_neighbor();
+      TRACE_END();
       neighbor->build();
       timer->stamp(TIME_NEIGHBOR);
     }
@@ -284,11 +294,14 @@ void Verlet::run(int n)
     // and Pair:ev_tally() needs to be called before any tallying
 
     force_clear();
+    TRACE_BEGIN("Modify::pre_force");
     if (n_pre_force) modify->pre_force(vflag);
+    TRACE_END();
 
     timer->stamp();
 
     if (pair_compute_flag) {
+      TRACE_REGION("Pair::compute");
       force->pair->compute(eflag,vflag);
       timer->stamp(TIME_PAIR);
     }
@@ -313,9 +326,17 @@ void Verlet::run(int n)
     }
 
     // force modifications, final time integration, diagnostics
+    TRACE_BEGIN("Modify::post_force");
     if (n_post_force) modify->post_force(vflag);
+    TRACE_END();
+    TRACE_BEGIN("Modify::final_integrate");
     modify->final_integrate();
+    TRACE_END();
+    TRACE_BEGIN("Modify::end_of_step");
     if (n_end_of_step) modify->end_of_step();
+    TRACE_END();
+    if (trace_every && ntimestep % trace_every == 0)
+      modify->write_timing_trace();
 
     // all output
     if (ntimestep == output->next) {
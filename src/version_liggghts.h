@@ -0,0 +1 @@
+#define LIGGGHTS_VERSION "LIGGGHTS-PFM 21.03, compiled 2026-10-18-11:10:40 by root, git commit 133f0c77b2f08c3b70e687436e003b69d13fd904,"